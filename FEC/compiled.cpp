@@ -0,0 +1,257 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: compiled.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "fec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace compiled {
+    template<class F, int T>
+    constexpr array<typename F::symbol_type, 2 * T + 1> build_generator() {
+        array<typename F::symbol_type, 2 * T + 1> new_generator = {};
+        new_generator[0] = 1;
+        for (int i = 0; i < 2 * T; i ++) {
+            typename F::symbol_type temp_0_root = F::exponent(i + 1);
+            for (int j = i + 1; j > 0; j --) {
+                new_generator[j] = new_generator[j - 1] ^ F::multiply(new_generator[j], temp_0_root);
+            }
+            new_generator[0] = F::multiply(new_generator[0], temp_0_root);
+        }
+        return new_generator;
+    }
+
+    template<class F, int T>
+    constexpr array<int, 2 * T> build_generator_logarithms() {
+        array<typename F::symbol_type, 2 * T + 1> temp_0_generator = build_generator<F, T>();
+        array<int, 2 * T> new_logarithms = {};
+        for (int i = 0; i < 2 * T; i ++) {
+            new_logarithms[i] = temp_0_generator[i] == 0 ? -1 : F::logarithm(temp_0_generator[i]);
+        }
+        return new_logarithms;
+    }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<class F, int T>
+    constexpr int RS<F, T>::codeword_length() {
+        return F::order;
+    }
+
+    template<class F, int T>
+    constexpr int RS<F, T>::message_length() {
+        return F::order - 2 * T;
+    }
+
+    template<class F, int T>
+    constexpr int RS<F, T>::parity_length() {
+        return 2 * T;
+    }
+
+    template<class F, int T>
+    constexpr int RS<F, T>::symbol_size() {
+        return F::degree;
+    }
+
+    template<class F, int T>
+    constexpr int RS<F, T>::correction_capability() {
+        return T;
+    }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<class F, int T>
+    void RS<F, T>::encode(const symbol_type* message, symbol_type* parity) const {
+        if (F::size < (1 << (8 * sizeof(symbol_type)))) {
+            for (int i = 0; i < message_length(); i ++) {
+                if (message[i] >= F::size) {
+                    throw "FEC\\compiled\\RS\\encode(const symbol_type*, symbol_type*)\\message";
+                }
+            }
+        }
+        array<symbol_type, F::order> temp_0_symbols = {};
+        copy(message, message + message_length(), temp_0_symbols.begin() + parity_length());
+        this->remainder(temp_0_symbols.data());
+        copy(temp_0_symbols.begin(), temp_0_symbols.begin() + parity_length(), parity);
+    }
+
+    template<class F, int T>
+    int RS<F, T>::decode(symbol_type* codeword) const {
+        if (F::size < (1 << (8 * sizeof(symbol_type)))) {
+            for (int i = 0; i < codeword_length(); i ++) {
+                if (codeword[i] >= F::size) {
+                    throw "FEC\\compiled\\RS\\decode(symbol_type*)\\codeword";
+                }
+            }
+        }
+        array<symbol_type, 2 * T> temp_0_syndrome;
+        if (!this->syndrome(codeword, temp_0_syndrome)) return 0;
+        array<symbol_type, 2 * T + 1> temp_1_error_locator;
+        int temp_2_degree = this->error_locator(temp_0_syndrome, temp_1_error_locator);
+        if (temp_2_degree > T) return -1;
+        array<symbol_type, 2 * T> temp_3_error_evaluator;
+        this->error_evaluator(temp_0_syndrome, temp_1_error_locator, temp_2_degree, temp_3_error_evaluator);
+        array<int, T> temp_4_positions;
+        int temp_5_count = this->chien_roots(temp_1_error_locator, temp_2_degree, temp_4_positions);
+        if (temp_5_count != temp_2_degree) return -1;
+        array<symbol_type, T> temp_6_error_values;
+        if (!this->error_values(temp_1_error_locator, temp_2_degree, temp_3_error_evaluator, temp_4_positions, temp_5_count, temp_6_error_values)) return -1;
+        for (int i = 0; i < temp_5_count; i ++) {
+            codeword[temp_4_positions[i]] = codeword[temp_4_positions[i]] ^ temp_6_error_values[i];
+        }
+        return temp_5_count;
+    }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<class F, int T>
+    void RS<F, T>::remainder(symbol_type* dividend) const {
+        if constexpr (F::degree <= 8) {
+            for (int i = codeword_length() - 1; i >= parity_length(); i --) {
+                if (dividend[i] != 0) {
+                    kernels::multiply_add(&F::tables.nibble_table[32 * dividend[i]], generator_polynomial.data(), dividend + i - parity_length(), parity_length());
+                }
+            }
+        } else {
+            for (int i = codeword_length() - 1; i >= parity_length(); i --) {
+                if (dividend[i] == 0) continue;
+                int temp_0_logarithm = F::tables.logarithm_table[dividend[i]];
+                symbol_type* temp_1_window = dividend + i - parity_length();
+                for (int j = 0; j < 2 * T; j ++) {
+                    if (generator_logarithms[j] >= 0) {
+                        temp_1_window[j] = temp_1_window[j] ^ F::tables.exponent_table[temp_0_logarithm + generator_logarithms[j]];
+                    }
+                }
+            }
+        }
+    }
+
+    template<class F, int T>
+    bool RS<F, T>::syndrome(const symbol_type* received, array<symbol_type, 2 * T>& syndrome) const {
+        array<symbol_type, F::order> temp_0_symbols;
+        copy(received, received + codeword_length(), temp_0_symbols.begin());
+        this->remainder(temp_0_symbols.data());
+        int temp_1_length = 2 * T;
+        while (temp_1_length > 0 && temp_0_symbols[temp_1_length - 1] == 0) {
+            temp_1_length --;
+        }
+        if (temp_1_length == 0) {
+            syndrome.fill(0);
+            return false;
+        }
+        for (int i = 0; i < 2 * T; i ++) {
+            uint32_t temp_2_bits = 0;
+            for (int j = temp_1_length - 1; j >= 0; j --) {
+                temp_2_bits = (temp_2_bits == 0 ? 0 : F::tables.exponent_table[F::tables.logarithm_table[temp_2_bits] + i + 1]) ^ temp_0_symbols[j];
+            }
+            syndrome[i] = temp_2_bits;
+        }
+        return true;
+    }
+
+    template<class F, int T>
+    int RS<F, T>::error_locator(const array<symbol_type, 2 * T>& syndrome, array<symbol_type, 2 * T + 1>& error_locator) const {
+        array<symbol_type, 2 * T + 1> temp_0_previous = {1};
+        array<symbol_type, 2 * T + 1> temp_1_backup = {};
+        error_locator.fill(0);
+        error_locator[0] = 1;
+        int new_degree = 0;
+        int temp_2_shift = 1;
+        uint32_t temp_3_previous_discrepancy = 1;
+        for (int i = 0; i < 2 * T; i ++) {
+            uint32_t temp_4_discrepancy = syndrome[i];
+            for (int j = 1; j <= T; j ++) {
+                if (j <= i) {
+                    temp_4_discrepancy = temp_4_discrepancy ^ F::multiply(error_locator[j], syndrome[i - j]);
+                }
+            }
+            if (temp_4_discrepancy == 0) {
+                temp_2_shift ++;
+                continue;
+            }
+            uint32_t temp_5_factor = F::divide(temp_4_discrepancy, temp_3_previous_discrepancy);
+            bool temp_6_lengthen = 2 * new_degree <= i;
+            if (temp_6_lengthen) {
+                temp_1_backup = error_locator;
+            }
+            for (int j = 1; j <= 2 * T; j ++) {
+                if (j >= temp_2_shift) {
+                    error_locator[j] = error_locator[j] ^ F::multiply(temp_5_factor, temp_0_previous[j - temp_2_shift]);
+                }
+            }
+            if (temp_6_lengthen) {
+                temp_0_previous = temp_1_backup;
+                new_degree = i + 1 - new_degree;
+                temp_3_previous_discrepancy = temp_4_discrepancy;
+                temp_2_shift = 1;
+            } else {
+                temp_2_shift ++;
+            }
+        }
+        return new_degree;
+    }
+
+    template<class F, int T>
+    void RS<F, T>::error_evaluator(const array<symbol_type, 2 * T>& syndrome, const array<symbol_type, 2 * T + 1>& error_locator, int degree, array<symbol_type, 2 * T>& error_evaluator) const {
+        error_evaluator.fill(0);
+        for (int i = 0; i < T; i ++) {
+            uint32_t temp_0_bits = 0;
+            for (int j = 0; j <= i; j ++) {
+                temp_0_bits = temp_0_bits ^ F::multiply(error_locator[j], syndrome[i - j]);
+            }
+            error_evaluator[i] = i < degree ? temp_0_bits : 0;
+        }
+    }
+
+    template<class F, int T>
+    int RS<F, T>::chien_roots(const array<symbol_type, 2 * T + 1>& error_locator, int degree, array<int, T>& positions) const {
+        array<int, T + 1> temp_0_registers;
+        for (int j = 0; j <= T; j ++) {
+            temp_0_registers[j] = j > degree || error_locator[j] == 0 ? -1 : F::tables.logarithm_table[error_locator[j]];
+        }
+        int new_count = 0;
+        for (int i = 0; i < codeword_length() && new_count < degree; i ++) {
+            uint32_t temp_1_bits = 0;
+            for (int j = 0; j <= T; j ++) {
+                if (temp_0_registers[j] < 0) continue;
+                temp_1_bits = temp_1_bits ^ F::tables.exponent_table[temp_0_registers[j]];
+                temp_0_registers[j] = temp_0_registers[j] + F::order - j;
+                if (temp_0_registers[j] >= F::order) temp_0_registers[j] -= F::order;
+            }
+            if (temp_1_bits == 0) {
+                positions[new_count ++] = i;
+            }
+        }
+        return new_count;
+    }
+
+    template<class F, int T>
+    bool RS<F, T>::error_values(const array<symbol_type, 2 * T + 1>& error_locator, int degree, const array<symbol_type, 2 * T>& error_evaluator, const array<int, T>& positions, int count, array<symbol_type, T>& error_values) const {
+        for (int i = 0; i < count; i ++) {
+            int temp_0_step = (F::order - positions[i]) % F::order;
+            int temp_1_power = 0;
+            uint32_t temp_2_numerator = 0;
+            uint32_t temp_3_denominator = 0;
+            for (int j = 0; j < T; j ++) {
+                if (error_evaluator[j] != 0) {
+                    temp_2_numerator = temp_2_numerator ^ F::tables.exponent_table[F::tables.logarithm_table[error_evaluator[j]] + temp_1_power];
+                }
+                if (j % 2 == 0 && error_locator[j + 1] != 0) {
+                    temp_3_denominator = temp_3_denominator ^ F::tables.exponent_table[F::tables.logarithm_table[error_locator[j + 1]] + temp_1_power];
+                }
+                temp_1_power = temp_1_power + temp_0_step;
+                if (temp_1_power >= F::order) temp_1_power -= F::order;
+            }
+            if (temp_3_denominator == 0) return false;
+            error_values[i] = F::divide(temp_2_numerator, temp_3_denominator);
+        }
+        return true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
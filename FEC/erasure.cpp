@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: erasure.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "fec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Erasure::Erasure(Field* symbol_field, int data_count, int parity_count, bool cauchy, int cache_capacity) : encode_matrix(symbol_field, data_count + parity_count, data_count) {
+    if (symbol_field->nibble_table.empty()) {
+        throw "FEC\\Erasure\\Erasure(Field*, int, int, bool, int)\\symbol_field";
+    } else if (data_count <= 0) {
+        throw "FEC\\Erasure\\Erasure(Field*, int, int, bool, int)\\data_count";
+    } else if (parity_count <= 0 || data_count + parity_count > symbol_field->size() - 1) {
+        throw "FEC\\Erasure\\Erasure(Field*, int, int, bool, int)\\parity_count";
+    } else if (cache_capacity < 0) {
+        throw "FEC\\Erasure\\Erasure(Field*, int, int, bool, int)\\cache_capacity";
+    }
+    this->symbol_field = symbol_field;
+    this->data_count = data_count;
+    this->parity_count = parity_count;
+    this->cache_capacity = cache_capacity;
+    this->cache_hits = 0;
+    this->cache_misses = 0;
+    if (cauchy) {
+        for (int i = 0; i < data_count; i ++) {
+            this->encode_matrix.at(i, i) = symbol_field->unit_element();
+        }
+        for (int i = 0; i < parity_count; i ++) {
+            for (int j = 0; j < data_count; j ++) {
+                this->encode_matrix.at(data_count + i, j) = ~(symbol_field->general_elements[data_count + i] + symbol_field->general_elements[j]);
+            }
+        }
+    } else {
+        Matrix temp_0_matrix(symbol_field, data_count + parity_count, data_count);
+        for (int i = 0; i < data_count + parity_count; i ++) {
+            for (int j = 0; j < data_count; j ++) {
+                temp_0_matrix.at(i, j) = symbol_field->general_elements[i] ^ j;
+            }
+        }
+        Matrix temp_1_matrix = temp_0_matrix.slice(0, 0, data_count, data_count).copy();
+        this->encode_matrix = temp_0_matrix * temp_1_matrix.invert();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int Erasure::shard_count() const {
+    return this->data_count + this->parity_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Erasure::encode(const vector<const uint8_t*>& data, const vector<uint8_t*>& parity, int size) const {
+    if (data.size() != this->data_count) {
+        throw "FEC\\Erasure\\encode(const vector<const uint8_t*>&, const vector<uint8_t*>&, int)\\data\\size";
+    } else if (parity.size() != this->parity_count) {
+        throw "FEC\\Erasure\\encode(const vector<const uint8_t*>&, const vector<uint8_t*>&, int)\\parity\\size";
+    } else if (size < 0) {
+        throw "FEC\\Erasure\\encode(const vector<const uint8_t*>&, const vector<uint8_t*>&, int)\\size";
+    }
+    for (int i = 0; i < this->parity_count; i ++) {
+        memset(parity[i], 0, size);
+        for (int j = 0; j < this->data_count; j ++) {
+            uint32_t temp_0_bits = this->encode_matrix.at(this->data_count + i, j).bits;
+            if (temp_0_bits != 0) {
+                kernels::multiply_add(&this->symbol_field->nibble_table[32 * temp_0_bits], data[j], parity[i], size);
+            }
+        }
+    }
+}
+
+void Erasure::decode(const vector<uint8_t*>& shards, const vector<bool>& present, int size) const {
+    if (shards.size() != this->shard_count()) {
+        throw "FEC\\Erasure\\decode(const vector<uint8_t*>&, const vector<bool>&, int)\\shards\\size";
+    } else if (present.size() != this->shard_count()) {
+        throw "FEC\\Erasure\\decode(const vector<uint8_t*>&, const vector<bool>&, int)\\present\\size";
+    } else if (size < 0) {
+        throw "FEC\\Erasure\\decode(const vector<uint8_t*>&, const vector<bool>&, int)\\size";
+    }
+    vector<int> temp_0_survivors;
+    for (int i = 0; i < this->shard_count() && temp_0_survivors.size() < this->data_count; i ++) {
+        if (present[i]) temp_0_survivors.push_back(i);
+    }
+    if (temp_0_survivors.size() < this->data_count) {
+        throw "FEC\\Erasure\\decode(const vector<uint8_t*>&, const vector<bool>&, int)\\present";
+    }
+    bool temp_1_data_lost = false;
+    for (int i = 0; i < this->data_count; i ++) {
+        temp_1_data_lost = temp_1_data_lost || !present[i];
+    }
+    if (temp_1_data_lost) {
+        shared_ptr<const Matrix> temp_2_matrix = this->decode_matrix(temp_0_survivors);
+        for (int i = 0; i < this->data_count; i ++) {
+            if (present[i]) continue;
+            memset(shards[i], 0, size);
+            for (int j = 0; j < this->data_count; j ++) {
+                uint32_t temp_3_bits = temp_2_matrix->at(i, j).bits;
+                if (temp_3_bits != 0) {
+                    kernels::multiply_add(&this->symbol_field->nibble_table[32 * temp_3_bits], shards[temp_0_survivors[j]], shards[i], size);
+                }
+            }
+        }
+    }
+    for (int i = this->data_count; i < this->shard_count(); i ++) {
+        if (present[i]) continue;
+        memset(shards[i], 0, size);
+        for (int j = 0; j < this->data_count; j ++) {
+            uint32_t temp_4_bits = this->encode_matrix.at(i, j).bits;
+            if (temp_4_bits != 0) {
+                kernels::multiply_add(&this->symbol_field->nibble_table[32 * temp_4_bits], shards[j], shards[i], size);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+shared_ptr<const Matrix> Erasure::decode_matrix(const vector<int>& survivors) const {
+    if (survivors.size() != this->data_count) {
+        throw "FEC\\Erasure\\decode_matrix(const vector<int>&)\\survivors\\size";
+    }
+    {
+        lock_guard<mutex> temp_0_guard(this->cache_lock);
+        auto temp_1_found = this->cache_index.find(survivors);
+        if (temp_1_found != this->cache_index.end()) {
+            this->cache_entries.splice(this->cache_entries.begin(), this->cache_entries, temp_1_found->second);
+            this->cache_hits ++;
+            return temp_1_found->second->second;
+        }
+        this->cache_misses ++;
+    }
+    shared_ptr<Matrix> temp_2_matrix = make_shared<Matrix>(this->symbol_field, this->data_count, this->data_count);
+    for (int i = 0; i < this->data_count; i ++) {
+        if (survivors[i] < 0 || survivors[i] >= this->shard_count()) {
+            throw "FEC\\Erasure\\decode_matrix(const vector<int>&)\\survivors";
+        }
+        copy_n(&this->encode_matrix.at(survivors[i], 0), this->data_count, &temp_2_matrix->at(i, 0));
+    }
+    temp_2_matrix->invert();
+    shared_ptr<const Matrix> new_matrix = temp_2_matrix;
+    if (this->cache_capacity > 0) {
+        lock_guard<mutex> temp_3_guard(this->cache_lock);
+        if (this->cache_index.find(survivors) == this->cache_index.end()) {
+            this->cache_entries.push_front(make_pair(survivors, new_matrix));
+            this->cache_index[survivors] = this->cache_entries.begin();
+            if (this->cache_entries.size() > this->cache_capacity) {
+                this->cache_index.erase(this->cache_entries.back().first);
+                this->cache_entries.pop_back();
+            }
+        }
+    }
+    return new_matrix;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
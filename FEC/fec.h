@@ -8,12 +8,27 @@
 #ifndef _FEC_H_
 #define _FEC_H_
 
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "../FFA/ffa.h"
 #include "../Maths/maths.h"
 
@@ -23,6 +38,10 @@ using namespace std;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class RS;
+class Stream;
+class Scheduler;
+class Erasure;
+class Statistics;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -30,10 +49,15 @@ class RS {
     public:
     Field* symbol_field;
     Polynomial generator_polynomial;
+    int block_length;
+    vector<uint8_t> generator_bytes;
+    vector<uint16_t> generator_words;
+    vector<int> generator_logarithms;
+    vector<uint8_t> parity_bytes;
 
     public:
     RS() = delete;
-    RS(Field* symbol_field, int correction_capability);
+    RS(Field* symbol_field, int correction_capability, int codeword_length = 0);
     ~RS() = default;
 
     public:
@@ -52,13 +76,49 @@ class RS {
     Polynomial add_error(const Polynomial& codeword, const Polynomial& error, const string& output_path = "output") const;
 
     public:
-    Polynomial pgz_decode(const Polynomial& received, const string& output_path = "output") const;
-    Polynomial bm_decode(const Polynomial& received, const string& output_path = "output") const;
-    Polynomial euclidean_decode(const Polynomial& received, const string& output_path = "output") const;
+    Polynomial pgz_decode(const Polynomial& received, const string& output_path = "output", Statistics* statistics = nullptr) const;
+    Polynomial bm_decode(const Polynomial& received, const string& output_path = "output", Statistics* statistics = nullptr) const;
+    Polynomial euclidean_decode(const Polynomial& received, const string& output_path = "output", Statistics* statistics = nullptr) const;
+    Polynomial half_gcd_decode(const Polynomial& received, const string& output_path = "output", Statistics* statistics = nullptr) const;
+
+    public:
+    void encode(const uint8_t* message, int message_size, uint8_t* parity, int parity_size) const;
+    int decode(uint8_t* codeword, int codeword_size) const;
+    void decode_batch(uint8_t* codewords, int count, int* results, int threads = 0, Statistics* statistics = nullptr) const;
+    void encode(const uint16_t* message, int message_size, uint16_t* parity, int parity_size) const;
+    void encode(const uint16_t* message, int message_size, uint16_t* parity, int parity_size, vector<uint16_t>& symbol_workspace) const;
+    int decode(uint16_t* codeword, int codeword_size) const;
+    int decode(uint16_t* codeword, int codeword_size, vector<uint16_t>& symbol_workspace, vector<int>& index_workspace) const;
+    void decode_batch(uint16_t* codewords, int count, int* results, int threads = 0, Statistics* statistics = nullptr) const;
+
+    public:
+    Matrix parity_matrix() const;
+    void encode_batch(const uint8_t* messages, int count, uint8_t* parities, int threads = 0) const;
+
+    private:
+    const uint8_t* parity_rows() const;
+    void byte_remainder(uint8_t* dividend, int size) const;
+    bool byte_syndrome(const uint8_t* received, uint8_t* syndrome) const;
+    int byte_error_locator(const uint8_t* syndrome, uint8_t* error_locator) const;
+    void byte_error_evaluator(const uint8_t* syndrome, const uint8_t* error_locator, int degree, uint8_t* error_evaluator) const;
+    int byte_chien_roots(const uint8_t* error_locator, int degree, int* positions) const;
+    bool byte_error_values(const uint8_t* error_locator, int degree, const uint8_t* error_evaluator, const int* positions, int count, uint8_t* error_values) const;
+
+    private:
+    void word_remainder(uint16_t* dividend, int size) const;
+    bool word_syndrome(const uint16_t* received, uint16_t* syndrome, uint16_t* workspace) const;
+    int word_error_locator(const uint16_t* syndrome, uint16_t* error_locator, uint16_t* workspace) const;
+    void word_error_evaluator(const uint16_t* syndrome, const uint16_t* error_locator, int degree, uint16_t* error_evaluator) const;
+    int word_chien_roots(const uint16_t* error_locator, int degree, int* positions, int* workspace) const;
+    bool word_error_values(const uint16_t* error_locator, int degree, const uint16_t* error_evaluator, const int* positions, int count, uint16_t* error_values, int* workspace) const;
+
+    private:
+    Polynomial key_equation_decode(const Polynomial& received, const string& output_path, Statistics* statistics, bool half_gcd_solver) const;
 
     private:
     vector<Element> syndrome(const Polynomial& received) const;
     Polynomial syndrome(const vector<Element>& syndrome) const;
+    bool syndrome_zero(const vector<Element>& syndrome) const;
 
     private:
     Polynomial pgz_error_locator(const vector<Element>& syndrome) const;
@@ -69,6 +129,9 @@ class RS {
     Polynomial pgz_error_evaluator(const Polynomial& syndrome, const Polynomial& error_locator) const;
     Polynomial bm_error_evaluator(const Polynomial& syndrome, const Polynomial& error_locator) const;
     Polynomial euclidean_error_evaluator(const Polynomial& syndrome) const;
+    void euclidean_key_equation(const Polynomial& syndrome, Polynomial& error_locator, Polynomial& error_evaluator) const;
+    void half_gcd_key_equation(const Polynomial& syndrome, Polynomial& error_locator, Polynomial& error_evaluator) const;
+    vector<Polynomial> half_gcd(const Polynomial& dividend, const Polynomial& divisor) const;
 
     private:
     vector<Element> chien_roots(const Polynomial& error_locator) const;
@@ -80,13 +143,154 @@ class RS {
 
     private:
     Polynomial estimated_error(const vector<Element>& roots, const vector<Element>& error_values) const;
-    Polynomial estimated_codeword(const Polynomial& received, const Polynomial& estimated_error) const;
+    Polynomial estimated_codeword(const Polynomial& received, const vector<Element>& roots, const vector<Element>& error_values) const;
     Polynomial estimated_message(const Polynomial& estimated_codeword) const;
+    int error_position(const Element& root) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Stream {
+    public:
+    RS* code;
+    long long blocks;
+    long long bytes;
+    long long corrected_symbols;
+    long long failed_blocks;
+    double seconds;
+
+    public:
+    Stream() = delete;
+    Stream(RS* code);
+    ~Stream() = default;
+
+    public:
+    void encode(const string& input_path, const string& output_path);
+    void decode(const string& input_path, const string& output_path);
+
+    public:
+    int header_size() const;
+    int symbol_bytes() const;
+    uint32_t code_bits() const;
+    uint32_t primitive_bits() const;
+    double throughput() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Scheduler {
+    public:
+    int threads;
+    int grain;
+
+    public:
+    Scheduler() = delete;
+    Scheduler(int threads, int grain = 16);
+    ~Scheduler() = default;
+
+    public:
+    void run(long long count, const function<void(long long)>& task) const;
+    void run(long long count, const function<void(long long, int)>& task) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Erasure {
+    public:
+    Field* symbol_field;
+    int data_count;
+    int parity_count;
+    Matrix encode_matrix;
+    int cache_capacity;
+    mutable list<pair<vector<int>, shared_ptr<const Matrix>>> cache_entries;
+    mutable map<vector<int>, list<pair<vector<int>, shared_ptr<const Matrix>>>::iterator> cache_index;
+    mutable mutex cache_lock;
+    mutable long long cache_hits;
+    mutable long long cache_misses;
+
+    public:
+    Erasure() = delete;
+    Erasure(Field* symbol_field, int data_count, int parity_count, bool cauchy = true, int cache_capacity = 64);
+    ~Erasure() = default;
+
+    public:
+    int shard_count() const;
+
+    public:
+    void encode(const vector<const uint8_t*>& data, const vector<uint8_t*>& parity, int size) const;
+    void decode(const vector<uint8_t*>& shards, const vector<bool>& present, int size) const;
+
+    public:
+    shared_ptr<const Matrix> decode_matrix(const vector<int>& survivors) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Statistics {
+    public:
+    long long decoded_blocks;
+    long long clean_blocks;
+
+    public:
+    Statistics();
+    ~Statistics() = default;
+
+    public:
+    void record(bool clean);
+    double clean_ratio() const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace compiled {
+    template<class F, int T>
+    constexpr array<typename F::symbol_type, 2 * T + 1> build_generator();
+
+    template<class F, int T>
+    constexpr array<int, 2 * T> build_generator_logarithms();
+
+    template<class F, int T>
+    class RS {
+        static_assert(T > 0 && 2 * T < F::order, "FEC\\compiled\\RS\\T");
+
+        public:
+        typedef typename F::symbol_type symbol_type;
+        static constexpr array<symbol_type, 2 * T + 1> generator_polynomial = build_generator<F, T>();
+        static constexpr array<int, 2 * T> generator_logarithms = build_generator_logarithms<F, T>();
+
+        public:
+        RS() = default;
+        ~RS() = default;
+
+        public:
+        static constexpr int codeword_length();
+        static constexpr int message_length();
+        static constexpr int parity_length();
+        static constexpr int symbol_size();
+        static constexpr int correction_capability();
+
+        public:
+        void encode(const symbol_type* message, symbol_type* parity) const;
+        int decode(symbol_type* codeword) const;
+
+        private:
+        void remainder(symbol_type* dividend) const;
+        bool syndrome(const symbol_type* received, array<symbol_type, 2 * T>& syndrome) const;
+        int error_locator(const array<symbol_type, 2 * T>& syndrome, array<symbol_type, 2 * T + 1>& error_locator) const;
+        void error_evaluator(const array<symbol_type, 2 * T>& syndrome, const array<symbol_type, 2 * T + 1>& error_locator, int degree, array<symbol_type, 2 * T>& error_evaluator) const;
+        int chien_roots(const array<symbol_type, 2 * T + 1>& error_locator, int degree, array<int, T>& positions) const;
+        bool error_values(const array<symbol_type, 2 * T + 1>& error_locator, int degree, const array<symbol_type, 2 * T>& error_evaluator, const array<int, T>& positions, int count, array<symbol_type, T>& error_values) const;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #include "rs.cpp"
+#include "stream.cpp"
+#include "scheduler.cpp"
+#include "erasure.cpp"
+#include "statistics.cpp"
+#include "compiled.cpp"
 
 #endif
 
@@ -10,25 +10,55 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-RS::RS(Field* symbol_field, int correction_capability) {
-    if (correction_capability <= 0 || 2 * correction_capability >= symbol_field->size() - 1) {
-        throw "FEC\\RS\\RS(Field*, int)\\correction_capability";
+RS::RS(Field* symbol_field, int correction_capability, int codeword_length) {
+    if (codeword_length < 0 || codeword_length > symbol_field->size() - 1) {
+        throw "FEC\\RS\\RS(Field*, int, int)\\codeword_length";
+    } else if (correction_capability <= 0 || 2 * correction_capability >= (codeword_length == 0 ? symbol_field->size() - 1 : codeword_length)) {
+        throw "FEC\\RS\\RS(Field*, int, int)\\correction_capability";
     }
     this->symbol_field = symbol_field;
+    this->block_length = codeword_length == 0 ? symbol_field->size() - 1 : codeword_length;
     this->generator_polynomial = Polynomial(this->symbol_field, {this->symbol_field->unit_element()});
     for (int i = 0; i < 2 * correction_capability; i ++) {
         this->generator_polynomial = this->generator_polynomial * Polynomial(this->symbol_field, {this->symbol_field->general_elements[i + 1], this->symbol_field->unit_element()});
     }
+    if (!this->symbol_field->nibble_table.empty()) {
+        this->generator_bytes = vector<uint8_t>(this->parity_length(), 0);
+        for (int i = 0; i < this->parity_length(); i ++) {
+            this->generator_bytes[i] = this->generator_polynomial.coefficients[i].bits;
+        }
+        this->parity_bytes = vector<uint8_t>(this->message_length() * this->parity_length(), 0);
+        memcpy(this->parity_bytes.data(), this->generator_bytes.data(), this->parity_length());
+        for (int i = 1; i < this->message_length(); i ++) {
+            const uint8_t* temp_0_previous = &this->parity_bytes[(i - 1) * this->parity_length()];
+            uint8_t* temp_1_current = &this->parity_bytes[i * this->parity_length()];
+            memcpy(temp_1_current + 1, temp_0_previous, this->parity_length() - 1);
+            uint8_t temp_2_carry = temp_0_previous[this->parity_length() - 1];
+            if (temp_2_carry != 0) {
+                kernels::multiply_add(&this->symbol_field->nibble_table[32 * temp_2_carry], this->generator_bytes.data(), temp_1_current, this->parity_length());
+            }
+        }
+    }
+    if (this->symbol_field->compact && this->symbol_size() <= 16) {
+        this->generator_words = vector<uint16_t>(this->parity_length(), 0);
+        this->generator_logarithms = vector<int>(this->parity_length(), -1);
+        for (int i = 0; i < this->parity_length(); i ++) {
+            this->generator_words[i] = this->generator_polynomial.coefficients[i].bits;
+            if (this->generator_words[i] != 0) {
+                this->generator_logarithms[i] = this->symbol_field->logarithm_table[this->generator_words[i]];
+            }
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int RS::codeword_length() const {
-    return this->symbol_field->size() - 1;
+    return this->block_length;
 }
 
 int RS::message_length() const {
-    return this->symbol_field->size() - this->generator_polynomial.degree() - 1;
+    return this->block_length + 1 - this->generator_polynomial.coefficients.size();
 }
 
 int RS::parity_length() const {
@@ -57,8 +87,23 @@ Polynomial RS::systematic_encode(const Polynomial& message, const string& output
         throw "FEC\\RS\\systematic_encode(const Polynomial&, const string&)\\message\\field";
     }
     Polynomial temp_0_polynomial(this->symbol_field, vector<Element>(this->parity_length() + 1, this->symbol_field->zero_element()));
-    temp_0_polynomial.coefficients[this->parity_length()] = this->symbol_field->unit_element();
-    temp_0_polynomial = ((message * temp_0_polynomial) + ((message * temp_0_polynomial) % this->generator_polynomial)).redegree(this->codeword_length() - 1);
+    if (!this->generator_bytes.empty()) {
+        vector<uint8_t> temp_1_bytes(this->codeword_length(), 0);
+        for (int i = 0; i < this->message_length(); i ++) {
+            temp_1_bytes[this->parity_length() + i] = message.coefficients[i].bits;
+        }
+        this->byte_remainder(temp_1_bytes.data(), this->codeword_length());
+        vector<Element> temp_2_coefficients(this->codeword_length(), this->symbol_field->zero_element());
+        for (int i = 0; i < this->codeword_length(); i ++) {
+            temp_2_coefficients[i] = i < this->parity_length() ? Element(this->symbol_field, uint32_t(temp_1_bytes[i])) : message.coefficients[i - this->parity_length()];
+        }
+        temp_0_polynomial = Polynomial(this->symbol_field, temp_2_coefficients);
+    } else {
+        vector<Element> temp_3_coefficients(this->codeword_length(), this->symbol_field->zero_element());
+        copy(message.coefficients.begin(), message.coefficients.end(), temp_3_coefficients.begin() + this->parity_length());
+        Polynomial temp_4_shifted(this->symbol_field, move(temp_3_coefficients));
+        temp_0_polynomial = (temp_4_shifted + (temp_4_shifted % this->generator_polynomial)).redegree(this->codeword_length() - 1);
+    }
     if (output_path != "output") {
         ofstream output_file("Output/" + output_path + ".txt");
         output_file << left << setw(16) << "polMes" << message << endl;
@@ -109,21 +154,35 @@ Polynomial RS::add_error(const Polynomial& codeword, const Polynomial& error, co
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Polynomial RS::pgz_decode(const Polynomial& received, const string& output_path) const {
+Polynomial RS::pgz_decode(const Polynomial& received, const string& output_path, Statistics* statistics) const {
     if (received.coefficients.size() != this->codeword_length()) {
-        throw "FEC\\RS\\pgz_decode(const Polynomial&, const string&)\\received\\coefficients\\size";
+        throw "FEC\\RS\\pgz_decode(const Polynomial&, const string&, Statistics*)\\received\\coefficients\\size";
     } else if (*received.field != *this->symbol_field) {
-        throw "FEC\\RS\\pgz_decode(const Polynomial&, const string&)\\received\\field";
+        throw "FEC\\RS\\pgz_decode(const Polynomial&, const string&, Statistics*)\\received\\field";
     }
     vector<Element> temp_0_syndrome = this->syndrome(received);
+    if (this->syndrome_zero(temp_0_syndrome)) {
+        if (statistics != nullptr) statistics->record(true);
+        Polynomial temp_1_estimated_message = this->estimated_message(received);
+        if (output_path != "output") {
+            ofstream output_file("Output/" + output_path + ".txt");
+            output_file << left << setw(16) << "polRec" << received << endl;
+            for (int i = 0; i < temp_0_syndrome.size(); i ++) {
+                output_file << left << setw(16) << "vecSyn[" + to_string(i) + "]" << temp_0_syndrome[i] << endl;
+            }
+            output_file << left << setw(16) << "polEstMes" << temp_1_estimated_message << endl;
+            output_file.close();
+        }
+        return temp_1_estimated_message;
+    }
+    if (statistics != nullptr) statistics->record(false);
     Polynomial temp_1_syndrome = this->syndrome(temp_0_syndrome);
     Polynomial temp_2_error_locator = this->pgz_error_locator(temp_0_syndrome);
     Polynomial temp_3_error_evaluator = this->pgz_error_evaluator(temp_1_syndrome, temp_2_error_locator);
     vector<Element> temp_4_roots = this->chien_roots(temp_2_error_locator);
     vector<Element> temp_5_error_values = this->pgz_error_values(temp_2_error_locator, temp_3_error_evaluator, temp_4_roots);
-    Polynomial temp_6_estimated_error = this->estimated_error(temp_4_roots, temp_5_error_values);
-    Polynomial temp_7_estimated_codeword = this->estimated_codeword(received, temp_6_estimated_error);
-    Polynomial temp_8_estimated_message = this->estimated_message(temp_7_estimated_codeword);
+    Polynomial temp_6_estimated_codeword = this->estimated_codeword(received, temp_4_roots, temp_5_error_values);
+    Polynomial temp_7_estimated_message = this->estimated_message(temp_6_estimated_codeword);
     if (output_path != "output") {
         ofstream output_file("Output/" + output_path + ".txt");
         output_file << left << setw(16) << "polRec" << received << endl;
@@ -139,29 +198,43 @@ Polynomial RS::pgz_decode(const Polynomial& received, const string& output_path)
         for (int i = 0; i < temp_5_error_values.size(); i ++) {
             output_file << left << setw(16) << "vecErrVal[" + to_string(i) + "]" << temp_5_error_values[i] << endl;
         }
-        output_file << left << setw(16) << "polEstErr" << temp_6_estimated_error << endl;
-        output_file << left << setw(16) << "polEstCod" << temp_7_estimated_codeword << endl;
-        output_file << left << setw(16) << "polEstMes" << temp_8_estimated_message << endl;
+        output_file << left << setw(16) << "polEstErr" << this->estimated_error(temp_4_roots, temp_5_error_values) << endl;
+        output_file << left << setw(16) << "polEstCod" << temp_6_estimated_codeword << endl;
+        output_file << left << setw(16) << "polEstMes" << temp_7_estimated_message << endl;
         output_file.close();
     }
-    return temp_8_estimated_message;
+    return temp_7_estimated_message;
 }
 
-Polynomial RS::bm_decode(const Polynomial& received, const string& output_path) const {
+Polynomial RS::bm_decode(const Polynomial& received, const string& output_path, Statistics* statistics) const {
     if (received.coefficients.size() != this->codeword_length()) {
-        throw "FEC\\RS\\bm_decode(const Polynomial&, const string&)\\received\\coefficients\\size";
+        throw "FEC\\RS\\bm_decode(const Polynomial&, const string&, Statistics*)\\received\\coefficients\\size";
     } else if (*received.field != *this->symbol_field) {
-        throw "FEC\\RS\\bm_decode(const Polynomial&, const string&)\\received\\field";
+        throw "FEC\\RS\\bm_decode(const Polynomial&, const string&, Statistics*)\\received\\field";
     }
     vector<Element> temp_0_syndrome = this->syndrome(received);
+    if (this->syndrome_zero(temp_0_syndrome)) {
+        if (statistics != nullptr) statistics->record(true);
+        Polynomial temp_1_estimated_message = this->estimated_message(received);
+        if (output_path != "output") {
+            ofstream output_file("Output/" + output_path + ".txt");
+            output_file << left << setw(16) << "polRec" << received << endl;
+            for (int i = 0; i < temp_0_syndrome.size(); i ++) {
+                output_file << left << setw(16) << "vecSyn[" + to_string(i) + "]" << temp_0_syndrome[i] << endl;
+            }
+            output_file << left << setw(16) << "polEstMes" << temp_1_estimated_message << endl;
+            output_file.close();
+        }
+        return temp_1_estimated_message;
+    }
+    if (statistics != nullptr) statistics->record(false);
     Polynomial temp_1_syndrome = this->syndrome(temp_0_syndrome);
     Polynomial temp_2_error_locator = this->bm_error_locator(temp_0_syndrome);
     Polynomial temp_3_error_evaluator = this->bm_error_evaluator(temp_1_syndrome, temp_2_error_locator);
     vector<Element> temp_4_roots = this->chien_roots(temp_2_error_locator);
     vector<Element> temp_5_error_values = this->bm_error_values(temp_2_error_locator, temp_3_error_evaluator, temp_4_roots);
-    Polynomial temp_6_estimated_error = this->estimated_error(temp_4_roots, temp_5_error_values);
-    Polynomial temp_7_estimated_codeword = this->estimated_codeword(received, temp_6_estimated_error);
-    Polynomial temp_8_estimated_message = this->estimated_message(temp_7_estimated_codeword);
+    Polynomial temp_6_estimated_codeword = this->estimated_codeword(received, temp_4_roots, temp_5_error_values);
+    Polynomial temp_7_estimated_message = this->estimated_message(temp_6_estimated_codeword);
     if (output_path != "output") {
         ofstream output_file("Output/" + output_path + ".txt");
         output_file << left << setw(16) << "polRec" << received << endl;
@@ -177,29 +250,62 @@ Polynomial RS::bm_decode(const Polynomial& received, const string& output_path)
         for (int i = 0; i < temp_5_error_values.size(); i ++) {
             output_file << left << setw(16) << "vecErrVal[" + to_string(i) + "]" << temp_5_error_values[i] << endl;
         }
-        output_file << left << setw(16) << "polEstErr" << temp_6_estimated_error << endl;
-        output_file << left << setw(16) << "polEstCod" << temp_7_estimated_codeword << endl;
-        output_file << left << setw(16) << "polEstMes" << temp_8_estimated_message << endl;
+        output_file << left << setw(16) << "polEstErr" << this->estimated_error(temp_4_roots, temp_5_error_values) << endl;
+        output_file << left << setw(16) << "polEstCod" << temp_6_estimated_codeword << endl;
+        output_file << left << setw(16) << "polEstMes" << temp_7_estimated_message << endl;
         output_file.close();
     }
-    return temp_8_estimated_message;
+    return temp_7_estimated_message;
+}
+
+Polynomial RS::euclidean_decode(const Polynomial& received, const string& output_path, Statistics* statistics) const {
+    if (received.coefficients.size() != this->codeword_length()) {
+        throw "FEC\\RS\\euclidean_decode(const Polynomial&, const string&, Statistics*)\\received\\coefficients\\size";
+    } else if (*received.field != *this->symbol_field) {
+        throw "FEC\\RS\\euclidean_decode(const Polynomial&, const string&, Statistics*)\\received\\field";
+    }
+    return this->key_equation_decode(received, output_path, statistics, false);
 }
 
-Polynomial RS::euclidean_decode(const Polynomial& received, const string& output_path) const {
+Polynomial RS::half_gcd_decode(const Polynomial& received, const string& output_path, Statistics* statistics) const {
     if (received.coefficients.size() != this->codeword_length()) {
-        throw "FEC\\RS\\euclidean_decode(const Polynomial&, const string&)\\received\\coefficients\\size";
+        throw "FEC\\RS\\half_gcd_decode(const Polynomial&, const string&, Statistics*)\\received\\coefficients\\size";
     } else if (*received.field != *this->symbol_field) {
-        throw "FEC\\RS\\euclidean_decode(const Polynomial&, const string&)\\received\\field";
+        throw "FEC\\RS\\half_gcd_decode(const Polynomial&, const string&, Statistics*)\\received\\field";
     }
+    return this->key_equation_decode(received, output_path, statistics, true);
+}
+
+// Shared by the Euclidean and half-GCD decoders, which differ only in how the key equation is solved
+Polynomial RS::key_equation_decode(const Polynomial& received, const string& output_path, Statistics* statistics, bool half_gcd_solver) const {
     vector<Element> temp_0_syndrome = this->syndrome(received);
+    if (this->syndrome_zero(temp_0_syndrome)) {
+        if (statistics != nullptr) statistics->record(true);
+        Polynomial temp_1_estimated_message = this->estimated_message(received);
+        if (output_path != "output") {
+            ofstream output_file("Output/" + output_path + ".txt");
+            output_file << left << setw(16) << "polRec" << received << endl;
+            for (int i = 0; i < temp_0_syndrome.size(); i ++) {
+                output_file << left << setw(16) << "vecSyn[" + to_string(i) + "]" << temp_0_syndrome[i] << endl;
+            }
+            output_file << left << setw(16) << "polEstMes" << temp_1_estimated_message << endl;
+            output_file.close();
+        }
+        return temp_1_estimated_message;
+    }
+    if (statistics != nullptr) statistics->record(false);
     Polynomial temp_1_syndrome = this->syndrome(temp_0_syndrome);
-    Polynomial temp_2_error_locator = this->euclidean_error_locator(temp_1_syndrome);
-    Polynomial temp_3_error_evaluator = this->euclidean_error_evaluator(temp_1_syndrome);
+    Polynomial temp_2_error_locator;
+    Polynomial temp_3_error_evaluator;
+    if (half_gcd_solver) {
+        this->half_gcd_key_equation(temp_1_syndrome, temp_2_error_locator, temp_3_error_evaluator);
+    } else {
+        this->euclidean_key_equation(temp_1_syndrome, temp_2_error_locator, temp_3_error_evaluator);
+    }
     vector<Element> temp_4_roots = this->chien_roots(temp_2_error_locator);
     vector<Element> temp_5_error_values = this->euclidean_error_values(temp_2_error_locator, temp_3_error_evaluator, temp_4_roots);
-    Polynomial temp_6_estimated_error = this->estimated_error(temp_4_roots, temp_5_error_values);
-    Polynomial temp_7_estimated_codeword = this->estimated_codeword(received, temp_6_estimated_error);
-    Polynomial temp_8_estimated_message = this->estimated_message(temp_7_estimated_codeword);
+    Polynomial temp_6_estimated_codeword = this->estimated_codeword(received, temp_4_roots, temp_5_error_values);
+    Polynomial temp_7_estimated_message = this->estimated_message(temp_6_estimated_codeword);
     if (output_path != "output") {
         ofstream output_file("Output/" + output_path + ".txt");
         output_file << left << setw(16) << "polRec" << received << endl;
@@ -215,28 +321,553 @@ Polynomial RS::euclidean_decode(const Polynomial& received, const string& output
         for (int i = 0; i < temp_5_error_values.size(); i ++) {
             output_file << left << setw(16) << "vecErrVal[" + to_string(i) + "]" << temp_5_error_values[i] << endl;
         }
-        output_file << left << setw(16) << "polEstErr" << temp_6_estimated_error << endl;
-        output_file << left << setw(16) << "polEstCod" << temp_7_estimated_codeword << endl;
-        output_file << left << setw(16) << "polEstMes" << temp_8_estimated_message << endl;
+        output_file << left << setw(16) << "polEstErr" << this->estimated_error(temp_4_roots, temp_5_error_values) << endl;
+        output_file << left << setw(16) << "polEstCod" << temp_6_estimated_codeword << endl;
+        output_file << left << setw(16) << "polEstMes" << temp_7_estimated_message << endl;
         output_file.close();
     }
-    return temp_8_estimated_message;
+    return temp_7_estimated_message;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void RS::encode(const uint8_t* message, int message_size, uint8_t* parity, int parity_size) const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\encode(const uint8_t*, int, uint8_t*, int)\\symbol_field";
+    } else if (message_size != this->message_length()) {
+        throw "FEC\\RS\\encode(const uint8_t*, int, uint8_t*, int)\\message_size";
+    } else if (parity_size != this->parity_length()) {
+        throw "FEC\\RS\\encode(const uint8_t*, int, uint8_t*, int)\\parity_size";
+    } else if (this->symbol_field->size() < 256) {
+        for (int i = 0; i < this->message_length(); i ++) {
+            if (message[i] >= this->symbol_field->size()) {
+                throw "FEC\\RS\\encode(const uint8_t*, int, uint8_t*, int)\\message";
+            }
+        }
+    }
+    uint8_t temp_0_bytes[256] = {};
+    memcpy(temp_0_bytes + this->parity_length(), message, this->message_length());
+    this->byte_remainder(temp_0_bytes, this->codeword_length());
+    memcpy(parity, temp_0_bytes, this->parity_length());
+}
+
+int RS::decode(uint8_t* codeword, int codeword_size) const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\decode(uint8_t*, int)\\symbol_field";
+    } else if (codeword_size != this->codeword_length()) {
+        throw "FEC\\RS\\decode(uint8_t*, int)\\codeword_size";
+    } else if (this->symbol_field->size() < 256) {
+        for (int i = 0; i < this->codeword_length(); i ++) {
+            if (codeword[i] >= this->symbol_field->size()) {
+                throw "FEC\\RS\\decode(uint8_t*, int)\\codeword";
+            }
+        }
+    }
+    uint8_t temp_0_syndrome[256];
+    if (!this->byte_syndrome(codeword, temp_0_syndrome)) return 0;
+    uint8_t temp_1_error_locator[256];
+    int temp_2_degree = this->byte_error_locator(temp_0_syndrome, temp_1_error_locator);
+    if (temp_2_degree > this->correction_capability()) return -1;
+    uint8_t temp_3_error_evaluator[256];
+    this->byte_error_evaluator(temp_0_syndrome, temp_1_error_locator, temp_2_degree, temp_3_error_evaluator);
+    int temp_4_positions[256];
+    int temp_5_count = this->byte_chien_roots(temp_1_error_locator, temp_2_degree, temp_4_positions);
+    if (temp_5_count != temp_2_degree) return -1;
+    uint8_t temp_6_error_values[256];
+    if (!this->byte_error_values(temp_1_error_locator, temp_2_degree, temp_3_error_evaluator, temp_4_positions, temp_5_count, temp_6_error_values)) return -1;
+    for (int i = 0; i < temp_5_count; i ++) {
+        codeword[temp_4_positions[i]] = codeword[temp_4_positions[i]] ^ temp_6_error_values[i];
+    }
+    return temp_5_count;
+}
+
+void RS::decode_batch(uint8_t* codewords, int count, int* results, int threads, Statistics* statistics) const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\decode_batch(uint8_t*, int, int*, int, Statistics*)\\symbol_field";
+    } else if (count < 0) {
+        throw "FEC\\RS\\decode_batch(uint8_t*, int, int*, int, Statistics*)\\count";
+    }
+    int temp_0_length = this->codeword_length();
+    Scheduler(threads).run(count, [&](long long i) {
+        results[i] = this->decode(codewords + i * temp_0_length, temp_0_length);
+    });
+    if (statistics != nullptr) {
+        for (int i = 0; i < count; i ++) {
+            statistics->record(results[i] == 0);
+        }
+    }
+}
+
+void RS::encode(const uint16_t* message, int message_size, uint16_t* parity, int parity_size) const {
+    vector<uint16_t> temp_0_workspace;
+    this->encode(message, message_size, parity, parity_size, temp_0_workspace);
+}
+
+void RS::encode(const uint16_t* message, int message_size, uint16_t* parity, int parity_size, vector<uint16_t>& symbol_workspace) const {
+    if (this->generator_words.empty()) {
+        throw "FEC\\RS\\encode(const uint16_t*, int, uint16_t*, int, vector<uint16_t>&)\\symbol_field";
+    } else if (message_size != this->message_length()) {
+        throw "FEC\\RS\\encode(const uint16_t*, int, uint16_t*, int, vector<uint16_t>&)\\message_size";
+    } else if (parity_size != this->parity_length()) {
+        throw "FEC\\RS\\encode(const uint16_t*, int, uint16_t*, int, vector<uint16_t>&)\\parity_size";
+    } else if (this->symbol_field->size() < 65536) {
+        for (int i = 0; i < this->message_length(); i ++) {
+            if (message[i] >= this->symbol_field->size()) {
+                throw "FEC\\RS\\encode(const uint16_t*, int, uint16_t*, int, vector<uint16_t>&)\\message";
+            }
+        }
+    }
+    if (symbol_workspace.size() < this->codeword_length()) {
+        symbol_workspace.resize(this->codeword_length());
+    }
+    uint16_t* temp_0_words = symbol_workspace.data();
+    memset(temp_0_words, 0, this->parity_length() * sizeof(uint16_t));
+    memcpy(temp_0_words + this->parity_length(), message, this->message_length() * sizeof(uint16_t));
+    this->word_remainder(temp_0_words, this->codeword_length());
+    memcpy(parity, temp_0_words, this->parity_length() * sizeof(uint16_t));
+}
+
+int RS::decode(uint16_t* codeword, int codeword_size) const {
+    vector<uint16_t> temp_0_symbols;
+    vector<int> temp_1_indices;
+    return this->decode(codeword, codeword_size, temp_0_symbols, temp_1_indices);
+}
+
+int RS::decode(uint16_t* codeword, int codeword_size, vector<uint16_t>& symbol_workspace, vector<int>& index_workspace) const {
+    if (this->generator_words.empty()) {
+        throw "FEC\\RS\\decode(uint16_t*, int, vector<uint16_t>&, vector<int>&)\\symbol_field";
+    } else if (codeword_size != this->codeword_length()) {
+        throw "FEC\\RS\\decode(uint16_t*, int, vector<uint16_t>&, vector<int>&)\\codeword_size";
+    } else if (this->symbol_field->size() < 65536) {
+        for (int i = 0; i < this->codeword_length(); i ++) {
+            if (codeword[i] >= this->symbol_field->size()) {
+                throw "FEC\\RS\\decode(uint16_t*, int, vector<uint16_t>&, vector<int>&)\\codeword";
+            }
+        }
+    }
+    int temp_0_scratch = max(this->codeword_length(), 2 * this->parity_length() + 2);
+    if (symbol_workspace.size() < temp_0_scratch + 4 * this->parity_length() + 1) {
+        symbol_workspace.resize(temp_0_scratch + 4 * this->parity_length() + 1);
+    }
+    if (index_workspace.size() < 3 * this->parity_length() + 3) {
+        index_workspace.resize(3 * this->parity_length() + 3);
+    }
+    uint16_t* temp_1_syndrome = symbol_workspace.data() + temp_0_scratch;
+    if (!this->word_syndrome(codeword, temp_1_syndrome, symbol_workspace.data())) return 0;
+    uint16_t* temp_2_error_locator = temp_1_syndrome + this->parity_length();
+    int temp_3_degree = this->word_error_locator(temp_1_syndrome, temp_2_error_locator, symbol_workspace.data());
+    if (temp_3_degree > this->correction_capability()) return -1;
+    uint16_t* temp_4_error_evaluator = temp_2_error_locator + this->parity_length() + 1;
+    this->word_error_evaluator(temp_1_syndrome, temp_2_error_locator, temp_3_degree, temp_4_error_evaluator);
+    int* temp_5_positions = index_workspace.data();
+    int temp_6_count = this->word_chien_roots(temp_2_error_locator, temp_3_degree, temp_5_positions, temp_5_positions + this->parity_length() + 1);
+    if (temp_6_count != temp_3_degree) return -1;
+    uint16_t* temp_7_error_values = temp_4_error_evaluator + this->parity_length();
+    if (!this->word_error_values(temp_2_error_locator, temp_3_degree, temp_4_error_evaluator, temp_5_positions, temp_6_count, temp_7_error_values, temp_5_positions + this->parity_length() + 1)) return -1;
+    for (int i = 0; i < temp_6_count; i ++) {
+        codeword[temp_5_positions[i]] = codeword[temp_5_positions[i]] ^ temp_7_error_values[i];
+    }
+    return temp_6_count;
+}
+
+void RS::decode_batch(uint16_t* codewords, int count, int* results, int threads, Statistics* statistics) const {
+    if (this->generator_words.empty()) {
+        throw "FEC\\RS\\decode_batch(uint16_t*, int, int*, int, Statistics*)\\symbol_field";
+    } else if (count < 0) {
+        throw "FEC\\RS\\decode_batch(uint16_t*, int, int*, int, Statistics*)\\count";
+    }
+    int temp_0_length = this->codeword_length();
+    Scheduler temp_1_scheduler(threads, 1);
+    vector<vector<uint16_t>> temp_2_symbols(temp_1_scheduler.threads);
+    vector<vector<int>> temp_3_indices(temp_1_scheduler.threads);
+    temp_1_scheduler.run(count, [&](long long i, int worker) {
+        results[i] = this->decode(codewords + i * temp_0_length, temp_0_length, temp_2_symbols[worker], temp_3_indices[worker]);
+    });
+    if (statistics != nullptr) {
+        for (int i = 0; i < count; i ++) {
+            statistics->record(results[i] == 0);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Matrix RS::parity_matrix() const {
+    Matrix new_matrix(this->symbol_field, this->message_length(), this->parity_length());
+    if (!this->generator_bytes.empty()) {
+        const uint8_t* temp_0_rows = this->parity_rows();
+        for (int i = 0; i < this->message_length(); i ++) {
+            for (int j = 0; j < this->parity_length(); j ++) {
+                new_matrix.at(i, j) = Element(this->symbol_field, uint32_t(temp_0_rows[i * this->parity_length() + j]));
+            }
+        }
+        return new_matrix;
+    }
+    vector<Element> temp_1_row(this->generator_polynomial.coefficients.begin(), this->generator_polynomial.coefficients.end() - 1);
+    for (int j = 0; j < this->parity_length(); j ++) {
+        temp_1_row[j] = -temp_1_row[j];
+    }
+    for (int i = 0; i < this->message_length(); i ++) {
+        copy(temp_1_row.begin(), temp_1_row.end(), &new_matrix.at(i, 0));
+        Element temp_2_carry = temp_1_row[this->parity_length() - 1];
+        for (int j = this->parity_length() - 1; j > 0; j --) {
+            temp_1_row[j] = temp_1_row[j - 1] - temp_2_carry * this->generator_polynomial.coefficients[j];
+        }
+        temp_1_row[0] = -(temp_2_carry * this->generator_polynomial.coefficients[0]);
+    }
+    return new_matrix;
+}
+
+void RS::encode_batch(const uint8_t* messages, int count, uint8_t* parities, int threads) const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\encode_batch(const uint8_t*, int, uint8_t*, int)\\symbol_field";
+    } else if (count < 0) {
+        throw "FEC\\RS\\encode_batch(const uint8_t*, int, uint8_t*, int)\\count";
+    } else if (this->symbol_field->size() < 256) {
+        for (long long i = 0; i < (long long) count * this->message_length(); i ++) {
+            if (messages[i] >= this->symbol_field->size()) {
+                throw "FEC\\RS\\encode_batch(const uint8_t*, int, uint8_t*, int)\\messages";
+            }
+        }
+    }
+    const uint8_t* temp_0_rows = this->parity_rows();
+    int temp_1_message_length = this->message_length();
+    int temp_2_parity_length = this->parity_length();
+    Scheduler(threads).run(count, [&](long long i) {
+        const uint8_t* temp_3_message = messages + i * temp_1_message_length;
+        uint8_t* temp_4_parity = parities + i * temp_2_parity_length;
+        memset(temp_4_parity, 0, temp_2_parity_length);
+        for (int j = 0; j < temp_1_message_length; j ++) {
+            if (temp_3_message[j] != 0) {
+                kernels::multiply_add(&this->symbol_field->nibble_table[32 * temp_3_message[j]], temp_0_rows + j * temp_2_parity_length, temp_4_parity, temp_2_parity_length);
+            }
+        }
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const uint8_t* RS::parity_rows() const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\parity_rows()";
+    }
+    return this->parity_bytes.data();
+}
+
+void RS::byte_remainder(uint8_t* dividend, int size) const {
+    if (this->generator_bytes.empty()) {
+        throw "FEC\\RS\\byte_remainder(uint8_t*, int)";
+    } else if (size < this->parity_length()) {
+        throw "FEC\\RS\\byte_remainder(uint8_t*, int)\\size";
+    }
+    for (int i = size - 1; i >= this->parity_length(); i --) {
+        if (dividend[i] != 0) {
+            kernels::multiply_add(&this->symbol_field->nibble_table[32 * dividend[i]], this->generator_bytes.data(), dividend + i - this->parity_length(), this->parity_length());
+        }
+    }
+}
+
+bool RS::byte_syndrome(const uint8_t* received, uint8_t* syndrome) const {
+    uint8_t temp_0_bytes[256];
+    memcpy(temp_0_bytes, received, this->codeword_length());
+    this->byte_remainder(temp_0_bytes, this->codeword_length());
+    int temp_1_length = this->parity_length();
+    while (temp_1_length > 0 && temp_0_bytes[temp_1_length - 1] == 0) {
+        temp_1_length --;
+    }
+    if (temp_1_length == 0) {
+        memset(syndrome, 0, this->parity_length());
+        return false;
+    }
+    for (int i = 0; i < this->parity_length(); i ++) {
+        uint32_t temp_2_argument = this->symbol_field->exponent_table[i + 1];
+        uint32_t temp_3_bits = 0;
+        for (int j = temp_1_length - 1; j >= 0; j --) {
+            temp_3_bits = this->symbol_field->multiply(temp_3_bits, temp_2_argument) ^ temp_0_bytes[j];
+        }
+        syndrome[i] = temp_3_bits;
+    }
+    return true;
+}
+
+int RS::byte_error_locator(const uint8_t* syndrome, uint8_t* error_locator) const {
+    uint8_t temp_0_previous[256] = {1};
+    uint8_t temp_1_backup[256];
+    memset(error_locator, 0, this->parity_length() + 1);
+    error_locator[0] = 1;
+    int new_degree = 0;
+    int temp_2_shift = 1;
+    uint32_t temp_3_previous_discrepancy = 1;
+    for (int i = 0; i < this->parity_length(); i ++) {
+        uint32_t temp_4_discrepancy = syndrome[i];
+        for (int j = 1; j <= new_degree; j ++) {
+            temp_4_discrepancy = temp_4_discrepancy ^ this->symbol_field->multiply(error_locator[j], syndrome[i - j]);
+        }
+        if (temp_4_discrepancy == 0) {
+            temp_2_shift ++;
+            continue;
+        }
+        uint32_t temp_5_factor = this->symbol_field->divide(temp_4_discrepancy, temp_3_previous_discrepancy);
+        if (2 * new_degree <= i) {
+            memcpy(temp_1_backup, error_locator, this->parity_length() + 1);
+            for (int j = 0; j + temp_2_shift <= this->parity_length(); j ++) {
+                error_locator[j + temp_2_shift] = error_locator[j + temp_2_shift] ^ this->symbol_field->multiply(temp_5_factor, temp_0_previous[j]);
+            }
+            memcpy(temp_0_previous, temp_1_backup, this->parity_length() + 1);
+            new_degree = i + 1 - new_degree;
+            temp_3_previous_discrepancy = temp_4_discrepancy;
+            temp_2_shift = 1;
+        } else {
+            for (int j = 0; j + temp_2_shift <= this->parity_length(); j ++) {
+                error_locator[j + temp_2_shift] = error_locator[j + temp_2_shift] ^ this->symbol_field->multiply(temp_5_factor, temp_0_previous[j]);
+            }
+            temp_2_shift ++;
+        }
+    }
+    return new_degree;
+}
+
+void RS::byte_error_evaluator(const uint8_t* syndrome, const uint8_t* error_locator, int degree, uint8_t* error_evaluator) const {
+    memset(error_evaluator, 0, this->parity_length());
+    for (int i = 0; i < degree; i ++) {
+        uint32_t temp_0_bits = 0;
+        for (int j = 0; j <= i; j ++) {
+            temp_0_bits = temp_0_bits ^ this->symbol_field->multiply(error_locator[j], syndrome[i - j]);
+        }
+        error_evaluator[i] = temp_0_bits;
+    }
+}
+
+int RS::byte_chien_roots(const uint8_t* error_locator, int degree, int* positions) const {
+    int temp_0_order = this->symbol_field->size() - 1;
+    int temp_1_registers[256];
+    for (int j = 0; j <= degree; j ++) {
+        temp_1_registers[j] = error_locator[j] == 0 ? -1 : this->symbol_field->logarithm_table[error_locator[j]];
+    }
+    int new_count = 0;
+    for (int i = 0; i < this->codeword_length() && new_count < degree; i ++) {
+        uint32_t temp_2_bits = 0;
+        for (int j = 0; j <= degree; j ++) {
+            if (temp_1_registers[j] < 0) continue;
+            temp_2_bits = temp_2_bits ^ this->symbol_field->exponent_table[temp_1_registers[j]];
+            temp_1_registers[j] = (temp_1_registers[j] + temp_0_order - j) % temp_0_order;
+        }
+        if (temp_2_bits == 0) {
+            positions[new_count ++] = i;
+        }
+    }
+    return new_count;
+}
+
+bool RS::byte_error_values(const uint8_t* error_locator, int degree, const uint8_t* error_evaluator, const int* positions, int count, uint8_t* error_values) const {
+    int temp_0_order = this->symbol_field->size() - 1;
+    int temp_1_evaluator[256];
+    int temp_2_derivative[256];
+    for (int j = 0; j < degree; j ++) {
+        temp_1_evaluator[j] = error_evaluator[j] == 0 ? -1 : this->symbol_field->logarithm_table[error_evaluator[j]];
+        temp_2_derivative[j] = j % 2 == 1 || error_locator[j + 1] == 0 ? -1 : this->symbol_field->logarithm_table[error_locator[j + 1]];
+    }
+    for (int i = 0; i < count; i ++) {
+        int temp_3_step = (temp_0_order - positions[i]) % temp_0_order;
+        int temp_4_power = 0;
+        uint32_t temp_5_numerator = 0;
+        uint32_t temp_6_denominator = 0;
+        for (int j = 0; j < degree; j ++) {
+            if (temp_1_evaluator[j] >= 0) {
+                temp_5_numerator = temp_5_numerator ^ this->symbol_field->exponent_table[temp_1_evaluator[j] + temp_4_power];
+            }
+            if (temp_2_derivative[j] >= 0) {
+                temp_6_denominator = temp_6_denominator ^ this->symbol_field->exponent_table[temp_2_derivative[j] + temp_4_power];
+            }
+            temp_4_power = (temp_4_power + temp_3_step) % temp_0_order;
+        }
+        if (temp_6_denominator == 0) return false;
+        error_values[i] = this->symbol_field->divide(temp_5_numerator, temp_6_denominator);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void RS::word_remainder(uint16_t* dividend, int size) const {
+    if (this->generator_words.empty()) {
+        throw "FEC\\RS\\word_remainder(uint16_t*, int)";
+    } else if (size < this->parity_length()) {
+        throw "FEC\\RS\\word_remainder(uint16_t*, int)\\size";
+    }
+    const uint32_t* temp_0_exponents = this->symbol_field->exponent_table.data();
+    const uint32_t* temp_1_logarithms = this->symbol_field->logarithm_table.data();
+    const int* temp_2_generator = this->generator_logarithms.data();
+    for (int i = size - 1; i >= this->parity_length(); i --) {
+        if (dividend[i] == 0) continue;
+        uint32_t temp_3_feedback = temp_1_logarithms[dividend[i]];
+        uint16_t* temp_4_window = dividend + i - this->parity_length();
+        for (int j = 0; j < this->parity_length(); j ++) {
+            if (temp_2_generator[j] >= 0) {
+                temp_4_window[j] = temp_4_window[j] ^ temp_0_exponents[temp_3_feedback + temp_2_generator[j]];
+            }
+        }
+    }
+}
+
+bool RS::word_syndrome(const uint16_t* received, uint16_t* syndrome, uint16_t* workspace) const {
+    uint16_t* temp_0_words = workspace;
+    memcpy(temp_0_words, received, this->codeword_length() * sizeof(uint16_t));
+    this->word_remainder(temp_0_words, this->codeword_length());
+    int temp_1_length = this->parity_length();
+    while (temp_1_length > 0 && temp_0_words[temp_1_length - 1] == 0) {
+        temp_1_length --;
+    }
+    if (temp_1_length == 0) {
+        memset(syndrome, 0, this->parity_length() * sizeof(uint16_t));
+        return false;
+    }
+    for (int i = 0; i < this->parity_length(); i ++) {
+        uint32_t temp_2_bits = 0;
+        for (int j = temp_1_length - 1; j >= 0; j --) {
+            temp_2_bits = temp_2_bits == 0 ? temp_0_words[j] : this->symbol_field->exponent_table[this->symbol_field->logarithm_table[temp_2_bits] + i + 1] ^ temp_0_words[j];
+        }
+        syndrome[i] = temp_2_bits;
+    }
+    return true;
+}
+
+int RS::word_error_locator(const uint16_t* syndrome, uint16_t* error_locator, uint16_t* workspace) const {
+    uint16_t* temp_0_previous = workspace;
+    uint16_t* temp_1_backup = workspace + this->parity_length() + 1;
+    memset(temp_0_previous, 0, (this->parity_length() + 1) * sizeof(uint16_t));
+    temp_0_previous[0] = 1;
+    memset(error_locator, 0, (this->parity_length() + 1) * sizeof(uint16_t));
+    error_locator[0] = 1;
+    int new_degree = 0;
+    int temp_2_shift = 1;
+    uint32_t temp_3_previous_discrepancy = 1;
+    for (int i = 0; i < this->parity_length(); i ++) {
+        uint32_t temp_4_discrepancy = syndrome[i];
+        for (int j = 1; j <= new_degree; j ++) {
+            temp_4_discrepancy = temp_4_discrepancy ^ this->symbol_field->multiply(error_locator[j], syndrome[i - j]);
+        }
+        if (temp_4_discrepancy == 0) {
+            temp_2_shift ++;
+            continue;
+        }
+        uint32_t temp_5_factor = this->symbol_field->divide(temp_4_discrepancy, temp_3_previous_discrepancy);
+        bool temp_6_lengthen = 2 * new_degree <= i;
+        if (temp_6_lengthen) {
+            memcpy(temp_1_backup, error_locator, (this->parity_length() + 1) * sizeof(uint16_t));
+        }
+        for (int j = 0; j + temp_2_shift <= this->parity_length(); j ++) {
+            error_locator[j + temp_2_shift] = error_locator[j + temp_2_shift] ^ this->symbol_field->multiply(temp_5_factor, temp_0_previous[j]);
+        }
+        if (temp_6_lengthen) {
+            swap(temp_0_previous, temp_1_backup);
+            new_degree = i + 1 - new_degree;
+            temp_3_previous_discrepancy = temp_4_discrepancy;
+            temp_2_shift = 1;
+        } else {
+            temp_2_shift ++;
+        }
+    }
+    return new_degree;
+}
+
+void RS::word_error_evaluator(const uint16_t* syndrome, const uint16_t* error_locator, int degree, uint16_t* error_evaluator) const {
+    memset(error_evaluator, 0, this->parity_length() * sizeof(uint16_t));
+    for (int i = 0; i < degree; i ++) {
+        uint32_t temp_0_bits = 0;
+        for (int j = 0; j <= i; j ++) {
+            temp_0_bits = temp_0_bits ^ this->symbol_field->multiply(error_locator[j], syndrome[i - j]);
+        }
+        error_evaluator[i] = temp_0_bits;
+    }
+}
+
+int RS::word_chien_roots(const uint16_t* error_locator, int degree, int* positions, int* workspace) const {
+    int temp_0_order = this->symbol_field->size() - 1;
+    int* temp_1_registers = workspace;
+    int* temp_2_steps = workspace + degree + 1;
+    for (int j = 0; j <= degree; j ++) {
+        temp_1_registers[j] = error_locator[j] == 0 ? -1 : this->symbol_field->logarithm_table[error_locator[j]];
+        temp_2_steps[j] = (temp_0_order - j % temp_0_order) % temp_0_order;
+    }
+    int new_count = 0;
+    for (int i = 0; i < this->codeword_length() && new_count < degree; i ++) {
+        uint32_t temp_3_bits = 0;
+        for (int j = 0; j <= degree; j ++) {
+            if (temp_1_registers[j] < 0) continue;
+            temp_3_bits = temp_3_bits ^ this->symbol_field->exponent_table[temp_1_registers[j]];
+            temp_1_registers[j] = temp_1_registers[j] + temp_2_steps[j];
+            if (temp_1_registers[j] >= temp_0_order) temp_1_registers[j] -= temp_0_order;
+        }
+        if (temp_3_bits == 0) {
+            positions[new_count ++] = i;
+        }
+    }
+    return new_count;
+}
+
+bool RS::word_error_values(const uint16_t* error_locator, int degree, const uint16_t* error_evaluator, const int* positions, int count, uint16_t* error_values, int* workspace) const {
+    int temp_0_order = this->symbol_field->size() - 1;
+    int* temp_1_evaluator = workspace;
+    int* temp_2_derivative = workspace + degree;
+    for (int j = 0; j < degree; j ++) {
+        temp_1_evaluator[j] = error_evaluator[j] == 0 ? -1 : this->symbol_field->logarithm_table[error_evaluator[j]];
+        temp_2_derivative[j] = j % 2 == 1 || error_locator[j + 1] == 0 ? -1 : this->symbol_field->logarithm_table[error_locator[j + 1]];
+    }
+    for (int i = 0; i < count; i ++) {
+        int temp_3_step = (temp_0_order - positions[i]) % temp_0_order;
+        int temp_4_power = 0;
+        uint32_t temp_5_numerator = 0;
+        uint32_t temp_6_denominator = 0;
+        for (int j = 0; j < degree; j ++) {
+            if (temp_1_evaluator[j] >= 0) {
+                temp_5_numerator = temp_5_numerator ^ this->symbol_field->exponent_table[temp_1_evaluator[j] + temp_4_power];
+            }
+            if (temp_2_derivative[j] >= 0) {
+                temp_6_denominator = temp_6_denominator ^ this->symbol_field->exponent_table[temp_2_derivative[j] + temp_4_power];
+            }
+            temp_4_power = (temp_4_power + temp_3_step) % temp_0_order;
+        }
+        if (temp_6_denominator == 0) return false;
+        error_values[i] = this->symbol_field->divide(temp_5_numerator, temp_6_denominator);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 vector<Element> RS::syndrome(const Polynomial& received) const {
     if (received.coefficients.size() != this->codeword_length()) {
         throw "FEC\\RS\\syndrome(const Polynomial&)\\received\\coefficients\\size";
     } else if (*received.field != *this->symbol_field) {
         throw "FEC\\RS\\syndrome(const Polynomial&)\\received\\field";
     }
-    vector<Element> temp_0_elements(this->parity_length(), this->symbol_field->zero_element());
-    for (int i = 0; i < temp_0_elements.size(); i ++) {
-        temp_0_elements[i] = received.evaluate(this->symbol_field->general_elements[i + 1]);
+    if (!this->generator_bytes.empty()) {
+        vector<uint8_t> temp_0_bytes(this->codeword_length(), 0);
+        for (int i = 0; i < this->codeword_length(); i ++) {
+            temp_0_bytes[i] = received.coefficients[i].bits;
+        }
+        this->byte_remainder(temp_0_bytes.data(), this->codeword_length());
+        int temp_1_length = this->parity_length();
+        while (temp_1_length > 0 && temp_0_bytes[temp_1_length - 1] == 0) {
+            temp_1_length --;
+        }
+        vector<Element> temp_2_elements(this->parity_length(), this->symbol_field->zero_element());
+        for (int i = 0; i < this->parity_length() && temp_1_length > 0; i ++) {
+            uint32_t temp_3_argument = this->symbol_field->exponent_table[i + 1];
+            uint32_t temp_4_bits = 0;
+            for (int j = temp_1_length - 1; j >= 0; j --) {
+                temp_4_bits = this->symbol_field->multiply(temp_4_bits, temp_3_argument) ^ temp_0_bytes[j];
+            }
+            temp_2_elements[i] = Element(this->symbol_field, temp_4_bits);
+        }
+        return temp_2_elements;
     }
-    return temp_0_elements;
+    vector<Element> temp_0_arguments(this->symbol_field->general_elements.begin() + 1, this->symbol_field->general_elements.begin() + 1 + this->parity_length());
+    vector<Element> temp_1_elements(this->parity_length(), this->symbol_field->zero_element());
+    received.evaluate(temp_0_arguments, temp_1_elements);
+    return temp_1_elements;
 }
 
 Polynomial RS::syndrome(const vector<Element>& syndrome) const {
@@ -252,6 +883,13 @@ Polynomial RS::syndrome(const vector<Element>& syndrome) const {
     return Polynomial(this->symbol_field, syndrome);
 }
 
+bool RS::syndrome_zero(const vector<Element>& syndrome) const {
+    for (int i = 0; i < syndrome.size(); i ++) {
+        if (syndrome[i] != this->symbol_field->zero_element()) return false;
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 Polynomial RS::pgz_error_locator(const vector<Element>& syndrome) const {
@@ -265,25 +903,39 @@ Polynomial RS::pgz_error_locator(const vector<Element>& syndrome) const {
         }
     }
     vector<Element> temp_0_coefficients(1, this->symbol_field->unit_element());
-    for (int i = this->correction_capability(); i > 0; i --) {
-        vector<vector<Element>> temp_1_elements(i, vector<Element>(i, this->symbol_field->zero_element()));
-        for (int j = 0; j < i; j ++) {
-            for (int k = 0; k < i; k ++) {
-                temp_1_elements[j][k] = syndrome[j + k];
-            }
+    vector<vector<Element>> temp_1_elements(this->correction_capability(), vector<Element>(this->correction_capability(), this->symbol_field->zero_element()));
+    for (int j = 0; j < this->correction_capability(); j ++) {
+        for (int k = 0; k < this->correction_capability(); k ++) {
+            temp_1_elements[j][k] = syndrome[j + k];
         }
-        Matrix temp_2_matrix(this->symbol_field, temp_1_elements);
-        if (temp_2_matrix.determinant() != this->symbol_field->zero_element()) {
-            vector<vector<Element>> temp_3_elements(i, vector<Element>(1, this->symbol_field->zero_element()));
-            for (int j = 0; j < i; j ++) {
-                temp_3_elements[j][0] = -syndrome[i + j];
-            }
-            Matrix temp_4_matrix = (~temp_2_matrix) * Matrix(this->symbol_field, temp_3_elements);
-            for (int j = 1; j <= i; j ++) {
-                temp_0_coefficients.push_back(temp_4_matrix.elements[i - j][0]);
-            }
-            break;
+    }
+    Matrix temp_2_matrix(this->symbol_field, temp_1_elements);
+    Matrix temp_3_lower_upper(this->symbol_field, this->correction_capability(), this->correction_capability());
+    vector<int> temp_4_permutation;
+    temp_2_matrix.decompose(temp_3_lower_upper, temp_4_permutation);
+    int temp_5_count = 0;
+    int temp_6_highest = -1;
+    for (int i = 0; i < this->correction_capability() && temp_3_lower_upper.at(i, i) != this->symbol_field->zero_element(); i ++) {
+        temp_6_highest = max(temp_6_highest, temp_4_permutation[i]);
+        if (temp_6_highest == i) {
+            temp_5_count = i + 1;
+        }
+    }
+    vector<Element> temp_7_solution(temp_5_count, this->symbol_field->zero_element());
+    for (int i = 0; i < temp_5_count; i ++) {
+        temp_7_solution[i] = -syndrome[temp_5_count + temp_4_permutation[i]];
+        for (int k = 0; k < i; k ++) {
+            temp_7_solution[i] = temp_7_solution[i] - temp_3_lower_upper.at(i, k) * temp_7_solution[k];
+        }
+    }
+    for (int i = temp_5_count - 1; i >= 0; i --) {
+        for (int k = i + 1; k < temp_5_count; k ++) {
+            temp_7_solution[i] = temp_7_solution[i] - temp_3_lower_upper.at(i, k) * temp_7_solution[k];
         }
+        temp_7_solution[i] = temp_7_solution[i] / temp_3_lower_upper.at(i, i);
+    }
+    for (int j = 1; j <= temp_5_count; j ++) {
+        temp_0_coefficients.push_back(temp_7_solution[temp_5_count - j]);
     }
     return Polynomial(this->symbol_field, temp_0_coefficients).redegree(this->correction_capability());
 }
@@ -298,28 +950,37 @@ Polynomial RS::bm_error_locator(const vector<Element>& syndrome) const {
             }
         }
     }
-    Polynomial temp_0_polynomial(this->symbol_field, {this->symbol_field->unit_element()});
-    Polynomial temp_1_polynomial(this->symbol_field, {this->symbol_field->unit_element()});
+    vector<Element> temp_0_coefficients(syndrome.size() + 1, this->symbol_field->zero_element());
+    temp_0_coefficients[0] = this->symbol_field->unit_element();
+    Polynomial temp_1_polynomial(this->symbol_field, temp_0_coefficients);
+    Polynomial temp_2_polynomial(this->symbol_field, temp_0_coefficients);
+    Polynomial temp_3_polynomial(this->symbol_field, move(temp_0_coefficients));
+    Element temp_4_previous_discrepancy = this->symbol_field->unit_element();
+    int temp_5_length = 0;
+    int temp_6_shift = 1;
     for (int i = 0; i < syndrome.size(); i ++) {
-        Element temp_2_discrepancy = this->symbol_field->zero_element();
-        for (int j = 0; j <= temp_1_polynomial.degree(); j ++) {
-            temp_2_discrepancy = temp_2_discrepancy + temp_1_polynomial.coefficients[j] * syndrome[i - j];
+        Element temp_7_discrepancy = syndrome[i];
+        for (int j = 1; j <= temp_5_length; j ++) {
+            temp_7_discrepancy = temp_7_discrepancy + temp_2_polynomial.coefficients[j] * syndrome[i - j];
+        }
+        if (temp_7_discrepancy == this->symbol_field->zero_element()) {
+            temp_6_shift ++;
+            continue;
         }
-        Polynomial temp_3_polynomial = Polynomial(this->symbol_field, {this->symbol_field->zero_element(), this->symbol_field->unit_element()}) * temp_0_polynomial;
-        if (temp_2_discrepancy == this->symbol_field->zero_element()) {
-            temp_0_polynomial = temp_3_polynomial;
+        Element temp_8_factor = -(temp_7_discrepancy / temp_4_previous_discrepancy);
+        if (2 * temp_5_length <= i) {
+            temp_3_polynomial.coefficients = temp_2_polynomial.coefficients;
+            temp_2_polynomial.multiply_add(temp_1_polynomial, temp_8_factor, temp_6_shift);
+            swap(temp_1_polynomial, temp_3_polynomial);
+            temp_5_length = i + 1 - temp_5_length;
+            temp_4_previous_discrepancy = temp_7_discrepancy;
+            temp_6_shift = 1;
         } else {
-            Polynomial temp_4_polynomial = temp_1_polynomial + Polynomial(this->symbol_field, {this->symbol_field->zero_element(), temp_2_discrepancy}) * temp_0_polynomial;
-            if (2 * temp_1_polynomial.degree() <= i - 1) {
-                temp_0_polynomial = temp_3_polynomial;
-                temp_1_polynomial = temp_4_polynomial;
-            } else {
-                temp_0_polynomial = temp_1_polynomial * (~temp_2_discrepancy);
-                temp_1_polynomial = temp_4_polynomial;
-            }
+            temp_2_polynomial.multiply_add(temp_1_polynomial, temp_8_factor, temp_6_shift);
+            temp_6_shift ++;
         }
     }
-    return temp_1_polynomial.redegree(this->correction_capability());
+    return temp_2_polynomial.redegree(this->correction_capability());
 }
 
 Polynomial RS::euclidean_error_locator(const Polynomial& syndrome) const {
@@ -328,18 +989,10 @@ Polynomial RS::euclidean_error_locator(const Polynomial& syndrome) const {
     } else if (*syndrome.field != *this->symbol_field) {
         throw "FEC\\RS\\euclidean_error_locator(const Polynomial&)\\syndrome\\field";
     }
-    Polynomial temp_0_polynomial(this->symbol_field, vector<Element>(2 * this->correction_capability() + 1, this->symbol_field->zero_element()));
-    temp_0_polynomial.coefficients[2 * this->correction_capability()] = this->symbol_field->unit_element();
-    Polynomial temp_1_polynomial = syndrome;
-    Polynomial temp_2_polynomial(this->symbol_field, {this->symbol_field->zero_element()});
-    Polynomial temp_3_polynomial(this->symbol_field, {this->symbol_field->unit_element()});
-    while (temp_1_polynomial.degree() >= this->correction_capability()) {
-        temp_2_polynomial = temp_2_polynomial - (temp_0_polynomial / temp_1_polynomial) * temp_3_polynomial;
-        swap(temp_2_polynomial, temp_3_polynomial);
-        temp_0_polynomial = temp_0_polynomial % temp_1_polynomial;
-        swap(temp_0_polynomial, temp_1_polynomial);
-    }
-    return temp_3_polynomial.redegree(this->correction_capability());
+    Polynomial new_polynomial;
+    Polynomial temp_0_polynomial;
+    this->euclidean_key_equation(syndrome, new_polynomial, temp_0_polynomial);
+    return new_polynomial;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,14 +1032,109 @@ Polynomial RS::euclidean_error_evaluator(const Polynomial& syndrome) const {
     } else if (*syndrome.field != *this->symbol_field) {
         throw "FEC\\RS\\euclidean_error_evaluator(const Polynomial&)\\syndrome\\field";
     }
+    Polynomial temp_0_polynomial;
+    Polynomial new_polynomial;
+    this->euclidean_key_equation(syndrome, temp_0_polynomial, new_polynomial);
+    return new_polynomial;
+}
+
+void RS::euclidean_key_equation(const Polynomial& syndrome, Polynomial& error_locator, Polynomial& error_evaluator) const {
+    if (syndrome.degree() >= 2 * this->correction_capability()) {
+        throw "FEC\\RS\\euclidean_key_equation(const Polynomial&, Polynomial&, Polynomial&)\\syndrome\\degree";
+    } else if (*syndrome.field != *this->symbol_field) {
+        throw "FEC\\RS\\euclidean_key_equation(const Polynomial&, Polynomial&, Polynomial&)\\syndrome\\field";
+    }
     Polynomial temp_0_polynomial(this->symbol_field, vector<Element>(2 * this->correction_capability() + 1, this->symbol_field->zero_element()));
     temp_0_polynomial.coefficients[2 * this->correction_capability()] = this->symbol_field->unit_element();
     Polynomial temp_1_polynomial = syndrome;
+    Polynomial temp_2_polynomial(this->symbol_field, vector<Element>(this->correction_capability() + 1, this->symbol_field->zero_element()));
+    Polynomial temp_3_polynomial(this->symbol_field, vector<Element>(this->correction_capability() + 1, this->symbol_field->zero_element()));
+    temp_3_polynomial.coefficients[0] = this->symbol_field->unit_element();
+    Polynomial temp_4_quotient;
     while (temp_1_polynomial.degree() >= this->correction_capability()) {
-        temp_0_polynomial = temp_0_polynomial % temp_1_polynomial;
+        temp_0_polynomial.divmod(temp_1_polynomial, temp_4_quotient, temp_0_polynomial);
+        for (int i = 0; i <= temp_4_quotient.degree(); i ++) {
+            temp_2_polynomial.multiply_add(temp_3_polynomial, -temp_4_quotient.coefficients[i], i);
+        }
+        swap(temp_2_polynomial, temp_3_polynomial);
         swap(temp_0_polynomial, temp_1_polynomial);
     }
-    return temp_1_polynomial.redegree(this->correction_capability() - 1);
+    error_locator = temp_3_polynomial.redegree(this->correction_capability());
+    error_evaluator = temp_1_polynomial.redegree(this->correction_capability() - 1);
+}
+
+void RS::half_gcd_key_equation(const Polynomial& syndrome, Polynomial& error_locator, Polynomial& error_evaluator) const {
+    if (syndrome.degree() >= 2 * this->correction_capability()) {
+        throw "FEC\\RS\\half_gcd_key_equation(const Polynomial&, Polynomial&, Polynomial&)\\syndrome\\degree";
+    } else if (*syndrome.field != *this->symbol_field) {
+        throw "FEC\\RS\\half_gcd_key_equation(const Polynomial&, Polynomial&, Polynomial&)\\syndrome\\field";
+    }
+    Polynomial temp_0_polynomial(this->symbol_field, vector<Element>(2 * this->correction_capability() + 1, this->symbol_field->zero_element()));
+    temp_0_polynomial.coefficients[2 * this->correction_capability()] = this->symbol_field->unit_element();
+    vector<Polynomial> temp_1_matrix = this->half_gcd(temp_0_polynomial, syndrome.align());
+    error_locator = temp_1_matrix[3].redegree(this->correction_capability());
+    error_evaluator = (temp_1_matrix[3] * syndrome).redegree(this->correction_capability() - 1);
+}
+
+// Returns {m00, m01, m10, m11} such that (m00 a + m01 b, m10 a + m11 b) are the two consecutive Euclidean remainders straddling degree ceil(deg a / 2)
+vector<Polynomial> RS::half_gcd(const Polynomial& dividend, const Polynomial& divisor) const {
+    Polynomial temp_0_zero(this->symbol_field, {this->symbol_field->zero_element()});
+    Polynomial temp_1_unit(this->symbol_field, {this->symbol_field->unit_element()});
+    vector<Polynomial> new_matrix = {temp_1_unit, temp_0_zero, temp_0_zero, temp_1_unit};
+    int temp_2_half = (dividend.degree() + 1) / 2;
+    if (dividend.degree() == 0 || divisor.degree() < temp_2_half) {
+        return new_matrix;
+    }
+    auto temp_3_apply = [](const vector<Polynomial>& matrix, const Polynomial& first, const Polynomial& second, Polynomial& first_result, Polynomial& second_result) {
+        first_result = matrix[0] * first + matrix[1] * second;
+        second_result = matrix[2] * first + matrix[3] * second;
+    };
+    auto temp_4_shift = [this](const Polynomial& polynomial, int shift) {
+        if (polynomial.coefficients.size() <= shift) {
+            return Polynomial(this->symbol_field, {this->symbol_field->zero_element()});
+        }
+        return Polynomial(this->symbol_field, vector<Element>(polynomial.coefficients.begin() + shift, polynomial.coefficients.end()));
+    };
+    if (dividend.degree() < 2 * polynomials::half_gcd_threshold) {
+        Polynomial temp_5_first = dividend;
+        Polynomial temp_6_second = divisor;
+        Polynomial temp_7_quotient;
+        while (temp_6_second.degree() >= temp_2_half) {
+            temp_5_first.divmod(temp_6_second, temp_7_quotient, temp_5_first);
+            swap(temp_5_first, temp_6_second);
+            for (int i = 0; i <= temp_7_quotient.degree(); i ++) {
+                new_matrix[0].multiply_add(new_matrix[2], -temp_7_quotient.coefficients[i], i);
+                new_matrix[1].multiply_add(new_matrix[3], -temp_7_quotient.coefficients[i], i);
+            }
+            swap(new_matrix[0], new_matrix[2]);
+            swap(new_matrix[1], new_matrix[3]);
+        }
+        return new_matrix;
+    }
+    new_matrix = this->half_gcd(temp_4_shift(dividend, temp_2_half), temp_4_shift(divisor, temp_2_half));
+    Polynomial temp_8_first;
+    Polynomial temp_9_second;
+    temp_3_apply(new_matrix, dividend, divisor, temp_8_first, temp_9_second);
+    temp_8_first = temp_8_first.align();
+    temp_9_second = temp_9_second.align();
+    if (temp_9_second.degree() < temp_2_half) {
+        return new_matrix;
+    }
+    Polynomial temp_10_quotient;
+    temp_8_first.divmod(temp_9_second, temp_10_quotient, temp_8_first);
+    swap(temp_8_first, temp_9_second);
+    new_matrix[0] = new_matrix[0] - temp_10_quotient * new_matrix[2];
+    new_matrix[1] = new_matrix[1] - temp_10_quotient * new_matrix[3];
+    swap(new_matrix[0], new_matrix[2]);
+    swap(new_matrix[1], new_matrix[3]);
+    int temp_11_shift = 2 * temp_2_half - temp_8_first.degree();
+    vector<Polynomial> temp_12_matrix = this->half_gcd(temp_4_shift(temp_8_first.align(), temp_11_shift), temp_4_shift(temp_9_second.align(), temp_11_shift));
+    return {
+        temp_12_matrix[0] * new_matrix[0] + temp_12_matrix[1] * new_matrix[2],
+        temp_12_matrix[0] * new_matrix[1] + temp_12_matrix[1] * new_matrix[3],
+        temp_12_matrix[2] * new_matrix[0] + temp_12_matrix[3] * new_matrix[2],
+        temp_12_matrix[2] * new_matrix[1] + temp_12_matrix[3] * new_matrix[3]
+    };
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -397,13 +1145,44 @@ vector<Element> RS::chien_roots(const Polynomial& error_locator) const {
     } else if (*error_locator.field != *this->symbol_field) {
         throw "FEC\\RS\\chien_roots(const Polynomial&)\\error_locator\\field";
     }
-    vector<Element> temp_0_elements;
-    for (int i = 0; i < this->symbol_field->size() - 1; i ++) {
-        if (error_locator.evaluate(this->symbol_field->general_elements[i]) == this->symbol_field->zero_element()) {
-            temp_0_elements.push_back(this->symbol_field->general_elements[i]);
+    int temp_0_order = this->symbol_field->size() - 1;
+    int temp_1_degree = error_locator.degree();
+    vector<Element> new_elements;
+    if (this->symbol_field->compact) {
+        vector<int> temp_2_registers(temp_1_degree + 1, -1);
+        for (int j = 0; j <= temp_1_degree; j ++) {
+            uint32_t temp_3_bits = error_locator.coefficients[j].bits;
+            temp_2_registers[j] = temp_3_bits == 0 ? -1 : this->symbol_field->logarithm_table[temp_3_bits];
+        }
+        for (int i = 0; i < this->codeword_length() && new_elements.size() < temp_1_degree; i ++) {
+            uint32_t temp_4_bits = 0;
+            for (int j = 0; j <= temp_1_degree; j ++) {
+                if (temp_2_registers[j] < 0) continue;
+                temp_4_bits = temp_4_bits ^ this->symbol_field->exponent_table[temp_2_registers[j]];
+                temp_2_registers[j] = (temp_2_registers[j] + temp_0_order - j) % temp_0_order;
+            }
+            if (temp_4_bits == 0) {
+                new_elements.push_back(this->symbol_field->general_elements[(temp_0_order - i) % temp_0_order]);
+            }
+        }
+        return new_elements;
+    }
+    vector<Element> temp_2_registers(error_locator.coefficients.begin(), error_locator.coefficients.begin() + temp_1_degree + 1);
+    vector<Element> temp_3_steps(temp_1_degree + 1, this->symbol_field->zero_element());
+    for (int j = 0; j <= temp_1_degree; j ++) {
+        temp_3_steps[j] = this->symbol_field->general_elements[(temp_0_order - j % temp_0_order) % temp_0_order];
+    }
+    for (int i = 0; i < this->codeword_length() && new_elements.size() < temp_1_degree; i ++) {
+        Element temp_4_sum = this->symbol_field->zero_element();
+        for (int j = 0; j <= temp_1_degree; j ++) {
+            temp_4_sum = temp_4_sum + temp_2_registers[j];
+            temp_2_registers[j] = temp_2_registers[j] * temp_3_steps[j];
+        }
+        if (temp_4_sum == this->symbol_field->zero_element()) {
+            new_elements.push_back(this->symbol_field->general_elements[(temp_0_order - i) % temp_0_order]);
         }
     }
-    return temp_0_elements;
+    return new_elements;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,11 +1205,35 @@ vector<Element> RS::pgz_error_values(const Polynomial& error_locator, const Poly
             }
         }
     }
-    vector<Element> temp_0_elements;
+    int temp_0_order = this->symbol_field->size() - 1;
+    Polynomial temp_1_derivative = error_locator.derivative();
+    vector<int> temp_2_evaluator(error_evaluator.degree() + 1, temp_0_order);
+    for (int j = 0; j < temp_2_evaluator.size(); j ++) {
+        temp_2_evaluator[j] = this->symbol_field->element_index(error_evaluator.coefficients[j]);
+    }
+    vector<int> temp_3_derivative(temp_1_derivative.degree() + 1, temp_0_order);
+    for (int j = 0; j < temp_3_derivative.size(); j ++) {
+        temp_3_derivative[j] = this->symbol_field->element_index(temp_1_derivative.coefficients[j]);
+    }
+    vector<Element> new_elements;
     for (int i = 0; i < roots.size(); i ++) {
-        temp_0_elements.push_back(error_evaluator.evaluate(roots[i]) / error_locator.derivative().evaluate(roots[i]));
+        int temp_4_root = this->symbol_field->element_index(roots[i]);
+        if (temp_4_root == temp_0_order) {
+            throw "FEC\\RS\\pgz_error_values(const Polynomial&, const Polynomial&, const vector<Element>&)\\roots";
+        }
+        Element temp_5_numerator = this->symbol_field->zero_element();
+        for (int j = 0; j < temp_2_evaluator.size(); j ++) {
+            if (temp_2_evaluator[j] == temp_0_order) continue;
+            temp_5_numerator = temp_5_numerator + this->symbol_field->general_elements[(temp_2_evaluator[j] + (long long) temp_4_root * j) % temp_0_order];
+        }
+        Element temp_6_denominator = this->symbol_field->zero_element();
+        for (int j = 0; j < temp_3_derivative.size(); j ++) {
+            if (temp_3_derivative[j] == temp_0_order) continue;
+            temp_6_denominator = temp_6_denominator + this->symbol_field->general_elements[(temp_3_derivative[j] + (long long) temp_4_root * j) % temp_0_order];
+        }
+        new_elements.push_back(temp_5_numerator / temp_6_denominator);
     }
-    return temp_0_elements;
+    return new_elements;
 }
 
 vector<Element> RS::bm_error_values(const Polynomial& error_locator, const Polynomial& error_evaluator, const vector<Element>& roots) const {
@@ -472,11 +1275,11 @@ vector<Element> RS::euclidean_error_values(const Polynomial& error_locator, cons
             }
         }
     }
-    vector<Element> temp_0_elements;
-    for (int i = 0; i < roots.size(); i ++) {
-        temp_0_elements.push_back(-error_evaluator.evaluate(roots[i]) / error_locator.derivative().evaluate(roots[i]));
+    vector<Element> new_elements = this->pgz_error_values(error_locator, error_evaluator, roots);
+    for (int i = 0; i < new_elements.size(); i ++) {
+        new_elements[i] = -new_elements[i];
     }
-    return temp_0_elements;
+    return new_elements;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -501,31 +1304,25 @@ Polynomial RS::estimated_error(const vector<Element>& roots, const vector<Elemen
     }
     vector<Element> temp_0_coefficients(this->codeword_length(), this->symbol_field->zero_element());
     for (int i = 0; i < roots.size(); i ++) {
-        Element temp_1_element = ~roots[i];
-        for (int j = 0; j < this->symbol_field->size() - 1; j ++) {
-            if (temp_1_element == this->symbol_field->general_elements[j]) {
-                temp_0_coefficients[j] = error_values[i];
-                break;
-            }
-            if (j == this->symbol_field->size() - 2) {
-                throw "FEC\\RS\\estimated_error(const vector<Element>&, const vector<Element>&)";
-            }
-        }
+        temp_0_coefficients[this->error_position(roots[i])] = error_values[i];
     }
     return Polynomial(this->symbol_field, temp_0_coefficients);
 }
 
-Polynomial RS::estimated_codeword(const Polynomial& received, const Polynomial& estimated_error) const {
+Polynomial RS::estimated_codeword(const Polynomial& received, const vector<Element>& roots, const vector<Element>& error_values) const {
     if (received.coefficients.size() != this->codeword_length()) {
-        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const Polynomial&)\\received\\coefficients\\size";
-    } else if (estimated_error.coefficients.size() != this->codeword_length()) {
-        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const Polynomial&)\\estimated_error\\coefficients\\size";
+        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const vector<Element>&, const vector<Element>&)\\received\\coefficients\\size";
+    } else if (roots.size() > this->correction_capability() || roots.size() != error_values.size()) {
+        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const vector<Element>&, const vector<Element>&)\\roots\\size";
     } else if (*received.field != *this->symbol_field) {
-        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const Polynomial&)\\received\\field";
-    } else if (*estimated_error.field != *this->symbol_field) {
-        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const Polynomial&)\\estimated_error\\field";
+        throw "FEC\\RS\\estimated_codeword(const Polynomial&, const vector<Element>&, const vector<Element>&)\\received\\field";
+    }
+    Polynomial new_polynomial = received;
+    for (int i = 0; i < roots.size(); i ++) {
+        int temp_0_position = this->error_position(roots[i]);
+        new_polynomial.coefficients[temp_0_position] = new_polynomial.coefficients[temp_0_position] - error_values[i];
     }
-    return (received - estimated_error).redegree(this->codeword_length() - 1);
+    return new_polynomial;
 }
 
 Polynomial RS::estimated_message(const Polynomial& estimated_codeword) const {
@@ -534,7 +1331,16 @@ Polynomial RS::estimated_message(const Polynomial& estimated_codeword) const {
     } else if (*estimated_codeword.field != *this->symbol_field) {
         throw "FEC\\RS\\estimated_message(const Polynomial&)\\estimated_codeword\\field";
     }
-    return estimated_codeword.redegree(this->message_length() - 1);
+    return Polynomial(this->symbol_field, vector<Element>(estimated_codeword.coefficients.begin() + this->parity_length(), estimated_codeword.coefficients.end()));
+}
+
+int RS::error_position(const Element& root) const {
+    int temp_0_order = this->symbol_field->size() - 1;
+    int temp_1_index = this->symbol_field->element_index(root);
+    if (temp_1_index == temp_0_order || (temp_0_order - temp_1_index) % temp_0_order >= this->codeword_length()) {
+        throw "FEC\\RS\\error_position(const Element&)\\root";
+    }
+    return (temp_0_order - temp_1_index) % temp_0_order;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
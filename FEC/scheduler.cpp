@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: scheduler.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "fec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Scheduler::Scheduler(int threads, int grain) {
+    if (grain <= 0) {
+        throw "FEC\\Scheduler\\Scheduler(int, int)\\grain";
+    }
+    this->threads = threads > 0 ? threads : max(1, int(thread::hardware_concurrency()));
+    this->grain = grain;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Scheduler::run(long long count, const function<void(long long)>& task) const {
+    this->run(count, function<void(long long, int)>([&](long long i, int) {
+        task(i);
+    }));
+}
+
+void Scheduler::run(long long count, const function<void(long long, int)>& task) const {
+    int temp_0_threads = int(min<long long>(this->threads, max<long long>(1, (count + this->grain - 1) / this->grain)));
+    vector<mutex> temp_1_locks(temp_0_threads);
+    vector<long long> temp_2_begins(temp_0_threads);
+    vector<long long> temp_3_ends(temp_0_threads);
+    for (int i = 0; i < temp_0_threads; i ++) {
+        temp_2_begins[i] = count * i / temp_0_threads;
+        temp_3_ends[i] = count * (i + 1) / temp_0_threads;
+    }
+    exception_ptr temp_4_exception = nullptr;
+    mutex temp_5_exception_lock;
+    auto temp_6_worker = [&](int index) {
+        try {
+            while (true) {
+                long long temp_7_begin = 0;
+                long long temp_8_end = 0;
+                {
+                    lock_guard<mutex> temp_9_guard(temp_1_locks[index]);
+                    temp_7_begin = temp_2_begins[index];
+                    temp_8_end = min(temp_3_ends[index], temp_7_begin + this->grain);
+                    temp_2_begins[index] = temp_8_end;
+                }
+                if (temp_7_begin == temp_8_end) {
+                    for (int i = 1; i < temp_0_threads && temp_7_begin == temp_8_end; i ++) {
+                        int temp_10_victim = (index + i) % temp_0_threads;
+                        lock_guard<mutex> temp_11_guard(temp_1_locks[temp_10_victim]);
+                        long long temp_12_remaining = temp_3_ends[temp_10_victim] - temp_2_begins[temp_10_victim];
+                        if (temp_12_remaining > 0) {
+                            temp_8_end = temp_3_ends[temp_10_victim];
+                            temp_7_begin = temp_8_end - (temp_12_remaining + 1) / 2;
+                            temp_3_ends[temp_10_victim] = temp_7_begin;
+                        }
+                    }
+                    if (temp_7_begin == temp_8_end) break;
+                    lock_guard<mutex> temp_13_guard(temp_1_locks[index]);
+                    temp_2_begins[index] = min(temp_8_end, temp_7_begin + this->grain);
+                    temp_3_ends[index] = temp_8_end;
+                    temp_8_end = temp_2_begins[index];
+                }
+                for (long long i = temp_7_begin; i < temp_8_end; i ++) {
+                    task(i, index);
+                }
+            }
+        } catch (...) {
+            lock_guard<mutex> temp_14_guard(temp_5_exception_lock);
+            if (!temp_4_exception) temp_4_exception = current_exception();
+        }
+    };
+    vector<thread> temp_15_threads;
+    for (int i = 1; i < temp_0_threads; i ++) {
+        temp_15_threads.push_back(thread(temp_6_worker, i));
+    }
+    temp_6_worker(0);
+    for (int i = 0; i < temp_15_threads.size(); i ++) {
+        temp_15_threads[i].join();
+    }
+    if (temp_4_exception) {
+        rethrow_exception(temp_4_exception);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,30 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: statistics.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "fec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Statistics::Statistics() {
+    this->decoded_blocks = 0;
+    this->clean_blocks = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Statistics::record(bool clean) {
+    this->decoded_blocks ++;
+    if (clean) this->clean_blocks ++;
+}
+
+double Statistics::clean_ratio() const {
+    return this->decoded_blocks > 0 ? double(this->clean_blocks) / this->decoded_blocks : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
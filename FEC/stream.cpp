@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: stream.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "fec.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Stream::Stream(RS* code) {
+    if (!(code->symbol_size() == 8 && !code->generator_bytes.empty()) && !(code->symbol_size() == 16 && !code->generator_words.empty())) {
+        throw "FEC\\Stream\\Stream(RS*)\\code";
+    }
+    this->code = code;
+    this->blocks = 0;
+    this->bytes = 0;
+    this->corrected_symbols = 0;
+    this->failed_blocks = 0;
+    this->seconds = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int Stream::header_size() const {
+    return 32;
+}
+
+int Stream::symbol_bytes() const {
+    return this->code->symbol_size() / 8;
+}
+
+uint32_t Stream::code_bits() const {
+    return uint32_t(this->code->correction_capability()) | (uint32_t(this->code->symbol_field->size() - 1 - this->code->codeword_length()) << 16);
+}
+
+uint32_t Stream::primitive_bits() const {
+    uint32_t new_bits = 0;
+    for (int i = 0; i <= this->code->symbol_size(); i ++) {
+        new_bits = new_bits | (uint32_t(this->code->symbol_field->primitive_polynomial->coefficients[i].value) << i);
+    }
+    return new_bits;
+}
+
+double Stream::throughput() const {
+    return this->seconds > 0 ? this->bytes / this->seconds : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Stream::encode(const string& input_path, const string& output_path) {
+    auto temp_0_start = chrono::steady_clock::now();
+    int temp_1_input = open(input_path.c_str(), O_RDONLY);
+    if (temp_1_input < 0) {
+        throw "FEC\\Stream\\encode(const string&, const string&)\\input_path";
+    }
+    struct stat temp_2_status;
+    if (fstat(temp_1_input, &temp_2_status) != 0) {
+        close(temp_1_input);
+        throw "FEC\\Stream\\encode(const string&, const string&)\\input_path";
+    }
+    uint64_t temp_3_size = temp_2_status.st_size;
+    const uint8_t* temp_4_source = nullptr;
+    if (temp_3_size > 0) {
+        void* temp_5_map = mmap(nullptr, temp_3_size, PROT_READ, MAP_PRIVATE, temp_1_input, 0);
+        if (temp_5_map == MAP_FAILED) {
+            close(temp_1_input);
+            throw "FEC\\Stream\\encode(const string&, const string&)\\input_path";
+        }
+        madvise(temp_5_map, temp_3_size, MADV_SEQUENTIAL);
+        temp_4_source = (const uint8_t*) temp_5_map;
+    }
+    int temp_6_message = this->code->message_length() * this->symbol_bytes();
+    int temp_7_codeword = this->code->codeword_length() * this->symbol_bytes();
+    int temp_8_parity = this->code->parity_length() * this->symbol_bytes();
+    uint64_t temp_9_blocks = (temp_3_size + temp_6_message - 1) / temp_6_message;
+    uint64_t temp_10_output_size = this->header_size() + temp_9_blocks * temp_7_codeword;
+    int temp_11_output = open(output_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (temp_11_output < 0 || ftruncate(temp_11_output, temp_10_output_size) != 0) {
+        if (temp_4_source) munmap((void*) temp_4_source, temp_3_size);
+        close(temp_1_input);
+        if (temp_11_output >= 0) close(temp_11_output);
+        throw "FEC\\Stream\\encode(const string&, const string&)\\output_path";
+    }
+    void* temp_12_map = mmap(nullptr, temp_10_output_size, PROT_READ | PROT_WRITE, MAP_SHARED, temp_11_output, 0);
+    if (temp_12_map == MAP_FAILED) {
+        if (temp_4_source) munmap((void*) temp_4_source, temp_3_size);
+        close(temp_1_input);
+        close(temp_11_output);
+        throw "FEC\\Stream\\encode(const string&, const string&)\\output_path";
+    }
+    uint8_t* temp_13_destination = (uint8_t*) temp_12_map;
+    uint32_t temp_14_header[8] = {0x31535352, uint32_t(this->code->symbol_size()), this->code_bits(), this->primitive_bits(), uint32_t(temp_3_size), uint32_t(temp_3_size >> 32), uint32_t(temp_9_blocks), uint32_t(temp_9_blocks >> 32)};
+    memcpy(temp_13_destination, temp_14_header, this->header_size());
+    vector<uint8_t> temp_15_message(temp_6_message);
+    vector<uint16_t> temp_16_words(this->symbol_bytes() == 2 ? this->code->codeword_length() : 0);
+    vector<uint16_t> temp_17_workspace;
+    for (uint64_t i = 0; i < temp_9_blocks; i ++) {
+        uint64_t temp_18_offset = i * temp_6_message;
+        uint8_t* temp_19_block = temp_13_destination + this->header_size() + i * temp_7_codeword;
+        const uint8_t* temp_20_message = temp_4_source + temp_18_offset;
+        if (temp_18_offset + temp_6_message > temp_3_size) {
+            memset(temp_15_message.data(), 0, temp_6_message);
+            memcpy(temp_15_message.data(), temp_20_message, temp_3_size - temp_18_offset);
+            temp_20_message = temp_15_message.data();
+        }
+        if (this->symbol_bytes() == 1) {
+            this->code->encode(temp_20_message, this->code->message_length(), temp_19_block, this->code->parity_length());
+        } else {
+            memcpy(temp_16_words.data() + this->code->parity_length(), temp_20_message, temp_6_message);
+            this->code->encode(temp_16_words.data() + this->code->parity_length(), this->code->message_length(), temp_16_words.data(), this->code->parity_length(), temp_17_workspace);
+            memcpy(temp_19_block, temp_16_words.data(), temp_8_parity);
+        }
+        memcpy(temp_19_block + temp_8_parity, temp_20_message, temp_6_message);
+    }
+    munmap(temp_12_map, temp_10_output_size);
+    close(temp_11_output);
+    if (temp_4_source) munmap((void*) temp_4_source, temp_3_size);
+    close(temp_1_input);
+    this->blocks = temp_9_blocks;
+    this->bytes = temp_3_size;
+    this->corrected_symbols = 0;
+    this->failed_blocks = 0;
+    this->seconds = chrono::duration<double>(chrono::steady_clock::now() - temp_0_start).count();
+}
+
+void Stream::decode(const string& input_path, const string& output_path) {
+    auto temp_0_start = chrono::steady_clock::now();
+    int temp_1_input = open(input_path.c_str(), O_RDONLY);
+    if (temp_1_input < 0) {
+        throw "FEC\\Stream\\decode(const string&, const string&)\\input_path";
+    }
+    struct stat temp_2_status;
+    if (fstat(temp_1_input, &temp_2_status) != 0) {
+        close(temp_1_input);
+        throw "FEC\\Stream\\decode(const string&, const string&)\\input_path";
+    }
+    uint64_t temp_3_size = temp_2_status.st_size;
+    if (temp_3_size < this->header_size()) {
+        close(temp_1_input);
+        throw "FEC\\Stream\\decode(const string&, const string&)\\input_path\\header";
+    }
+    void* temp_4_map = mmap(nullptr, temp_3_size, PROT_READ, MAP_PRIVATE, temp_1_input, 0);
+    if (temp_4_map == MAP_FAILED) {
+        close(temp_1_input);
+        throw "FEC\\Stream\\decode(const string&, const string&)\\input_path";
+    }
+    madvise(temp_4_map, temp_3_size, MADV_SEQUENTIAL);
+    const uint8_t* temp_5_source = (const uint8_t*) temp_4_map;
+    uint32_t temp_6_header[8];
+    memcpy(temp_6_header, temp_5_source, this->header_size());
+    int temp_7_message = this->code->message_length() * this->symbol_bytes();
+    int temp_8_codeword = this->code->codeword_length() * this->symbol_bytes();
+    int temp_9_parity = this->code->parity_length() * this->symbol_bytes();
+    uint64_t temp_10_output_size = temp_6_header[4] | (uint64_t(temp_6_header[5]) << 32);
+    uint64_t temp_11_blocks = temp_6_header[6] | (uint64_t(temp_6_header[7]) << 32);
+    if (temp_6_header[0] != 0x31535352 || temp_6_header[1] != this->code->symbol_size() || temp_6_header[2] != this->code_bits() || temp_6_header[3] != this->primitive_bits()
+        || temp_11_blocks != (temp_10_output_size + temp_7_message - 1) / temp_7_message || temp_3_size != this->header_size() + temp_11_blocks * temp_8_codeword) {
+        munmap(temp_4_map, temp_3_size);
+        close(temp_1_input);
+        throw "FEC\\Stream\\decode(const string&, const string&)\\input_path\\header";
+    }
+    int temp_12_output = open(output_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (temp_12_output < 0 || ftruncate(temp_12_output, temp_10_output_size) != 0) {
+        munmap(temp_4_map, temp_3_size);
+        close(temp_1_input);
+        if (temp_12_output >= 0) close(temp_12_output);
+        throw "FEC\\Stream\\decode(const string&, const string&)\\output_path";
+    }
+    uint8_t* temp_13_destination = nullptr;
+    if (temp_10_output_size > 0) {
+        void* temp_14_map = mmap(nullptr, temp_10_output_size, PROT_READ | PROT_WRITE, MAP_SHARED, temp_12_output, 0);
+        if (temp_14_map == MAP_FAILED) {
+            munmap(temp_4_map, temp_3_size);
+            close(temp_1_input);
+            close(temp_12_output);
+            throw "FEC\\Stream\\decode(const string&, const string&)\\output_path";
+        }
+        temp_13_destination = (uint8_t*) temp_14_map;
+    }
+    long long temp_15_corrected = 0;
+    long long temp_16_failed = 0;
+    vector<uint8_t> temp_17_block(temp_8_codeword);
+    vector<uint16_t> temp_18_words(this->symbol_bytes() == 2 ? this->code->codeword_length() : 0);
+    vector<uint16_t> temp_19_symbols;
+    vector<int> temp_20_indices;
+    for (uint64_t i = 0; i < temp_11_blocks; i ++) {
+        memcpy(temp_17_block.data(), temp_5_source + this->header_size() + i * temp_8_codeword, temp_8_codeword);
+        int temp_21_count;
+        if (this->symbol_bytes() == 1) {
+            temp_21_count = this->code->decode(temp_17_block.data(), this->code->codeword_length());
+        } else {
+            memcpy(temp_18_words.data(), temp_17_block.data(), temp_8_codeword);
+            temp_21_count = this->code->decode(temp_18_words.data(), this->code->codeword_length(), temp_19_symbols, temp_20_indices);
+            memcpy(temp_17_block.data(), temp_18_words.data(), temp_8_codeword);
+        }
+        if (temp_21_count < 0) {
+            temp_16_failed ++;
+        } else {
+            temp_15_corrected += temp_21_count;
+        }
+        uint64_t temp_22_offset = i * temp_7_message;
+        memcpy(temp_13_destination + temp_22_offset, temp_17_block.data() + temp_9_parity, min<uint64_t>(temp_7_message, temp_10_output_size - temp_22_offset));
+    }
+    if (temp_13_destination) munmap(temp_13_destination, temp_10_output_size);
+    close(temp_12_output);
+    munmap(temp_4_map, temp_3_size);
+    close(temp_1_input);
+    this->blocks = temp_11_blocks;
+    this->bytes = temp_10_output_size;
+    this->corrected_symbols = temp_15_corrected;
+    this->failed_blocks = temp_16_failed;
+    this->seconds = chrono::duration<double>(chrono::steady_clock::now() - temp_0_start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
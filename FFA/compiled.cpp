@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: compiled.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ffa.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace compiled {
+    template<unsigned M, uint32_t Primitive>
+    constexpr Tables<M> build_tables() {
+        Tables<M> new_tables = {};
+        uint32_t temp_0_bits = 1;
+        for (int i = 0; i < (1 << M) - 1; i ++) {
+            if (i != 0 && temp_0_bits == 1) {
+                throw "FFA\\compiled\\build_tables()\\Primitive";
+            }
+            new_tables.exponent_table[i] = temp_0_bits;
+            new_tables.exponent_table[i + (1 << M) - 1] = temp_0_bits;
+            new_tables.logarithm_table[temp_0_bits] = i;
+            temp_0_bits = temp_0_bits << 1;
+            if (temp_0_bits & (1 << M)) {
+                temp_0_bits = temp_0_bits ^ Primitive;
+            }
+        }
+        if (temp_0_bits != 1) {
+            throw "FFA\\compiled\\build_tables()\\Primitive";
+        }
+        if (M <= 8) {
+            for (int i = 1; i < (1 << M); i ++) {
+                for (int j = 1; j < 16; j ++) {
+                    if (j < (1 << M)) {
+                        new_tables.nibble_table[32 * i + j] = new_tables.exponent_table[new_tables.logarithm_table[i] + new_tables.logarithm_table[j]];
+                    }
+                    if ((j << 4) < (1 << M)) {
+                        new_tables.nibble_table[32 * i + 16 + j] = new_tables.exponent_table[new_tables.logarithm_table[i] + new_tables.logarithm_table[j << 4]];
+                    }
+                }
+            }
+        }
+        return new_tables;
+    }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<unsigned M, uint32_t Primitive>
+    constexpr typename Field<M, Primitive>::symbol_type Field<M, Primitive>::exponent(int power) {
+        return tables.exponent_table[power % order];
+    }
+
+    template<unsigned M, uint32_t Primitive>
+    constexpr int Field<M, Primitive>::logarithm(uint32_t element) {
+        if (element == 0) {
+            throw "FFA\\compiled\\Field\\logarithm(uint32_t)\\element";
+        }
+        return tables.logarithm_table[element];
+    }
+
+    template<unsigned M, uint32_t Primitive>
+    constexpr typename Field<M, Primitive>::symbol_type Field<M, Primitive>::multiply(uint32_t multiplicand, uint32_t multiplier) {
+        if (multiplicand == 0 || multiplier == 0) return 0;
+        return tables.exponent_table[tables.logarithm_table[multiplicand] + tables.logarithm_table[multiplier]];
+    }
+
+    template<unsigned M, uint32_t Primitive>
+    constexpr typename Field<M, Primitive>::symbol_type Field<M, Primitive>::divide(uint32_t dividend, uint32_t divisor) {
+        if (divisor == 0) {
+            throw "FFA\\compiled\\Field\\divide(uint32_t, uint32_t)\\divisor";
+        }
+        if (dividend == 0) return 0;
+        return tables.exponent_table[tables.logarithm_table[dividend] + order - tables.logarithm_table[divisor]];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -14,6 +14,7 @@ Element::Element(bool value) {
     this->field = &fields::default_field;
     this->value = value;
     this->values = vector<Element>();
+    this->bits = 0;
 }
 
 Element::Element(Field* field, vector<Element> values) {
@@ -22,14 +23,31 @@ Element::Element(Field* field, vector<Element> values) {
     }
     this->field = field;
     this->value = false;
-    this->values = values;
+    this->bits = 0;
+    if (field->compact) {
+        for (int i = 0; i < values.size(); i ++) {
+            this->bits = this->bits | (uint32_t(values[i].value) << i);
+        }
+    } else {
+        this->values = values;
+    }
+}
+
+Element::Element(Field* field, uint32_t bits) {
+    if (!field->compact) {
+        throw "FFA\\Element\\Element(Field*, uint32_t)\\field";
+    } else if (bits >= field->logarithm_table.size()) {
+        throw "FFA\\Element\\Element(Field*, uint32_t)\\bits";
+    }
+    this->field = field;
+    this->value = false;
+    this->bits = bits;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool Element::operator==(const Element& element) const {
-    if (this->field == element.field && this->value == element.value && this->values == element.values) return true;
-    return *this->field == *element.field && this->value == element.value && this->values == element.values;
+    return this->field->identity == element.field->identity && this->value == element.value && this->bits == element.bits && this->values == element.values;
 }
 
 bool Element::operator!=(const Element& element) const {
@@ -39,6 +57,15 @@ bool Element::operator!=(const Element& element) const {
 ostream& operator<<(ostream& output, const Element& element) {
     if (*element.field == fields::default_field) {
         output << element.value;
+    } else if (element.field->compact) {
+        output << "{";
+        for (int i = 0; i < element.size(); i ++) {
+            output << ((element.bits >> i) & 1);
+            if (i != element.size() - 1) {
+                output << ", ";
+            }
+        }
+        output << "}";
     } else {
         output << "{";
         for (int i = 0; i < element.values.size(); i ++) {
@@ -68,6 +95,9 @@ Element Element::operator+(const Element& element) const {
     if (*this->field == fields::default_field) {
         bool new_value = this->value ^ element.value;
         return Element(new_value);
+    } else if (this->field->compact) {
+        uint32_t new_bits = this->field->add(this->bits, element.bits);
+        return Element(this->field, new_bits);
     } else {
         Polynomial temp_0_polynomial(this->field->primitive_polynomial->field, this->values);
         Polynomial temp_1_polynomial(element.field->primitive_polynomial->field, element.values);
@@ -83,6 +113,9 @@ Element Element::operator*(const Element& element) const {
     if (*this->field == fields::default_field) {
         bool new_value = this->value & element.value;
         return Element(new_value);
+    } else if (this->field->compact) {
+        uint32_t new_bits = this->field->multiply(this->bits, element.bits);
+        return Element(this->field, new_bits);
     } else {
         Polynomial temp_0_polynomial(this->field->primitive_polynomial->field, this->values);
         Polynomial temp_1_polynomial(element.field->primitive_polynomial->field, element.values);
@@ -94,26 +127,30 @@ Element Element::operator*(const Element& element) const {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 Element Element::operator-() const {
-    for (int i = 0; i < this->field->general_elements.size(); i ++) {
-        if (*this + this->field->general_elements[i] == this->field->zero_element()) return this->field->general_elements[i];
-    }
-    throw "FFA\\Element\\operator-()";
+    return this->field->general_elements[this->field->negation_table[this->field->element_index(*this)]];
 }
 
 Element Element::operator~() const {
-    for (int i = 0; i < this->field->general_elements.size(); i ++) {
-        if (*this * this->field->general_elements[i] == this->field->unit_element()) return this->field->general_elements[i];
+    int temp_0_index = this->field->inverse_table[this->field->element_index(*this)];
+    if (temp_0_index < 0) {
+        throw "FFA\\Element\\operator~()";
     }
-    throw "FFA\\Element\\operator~()";
+    return this->field->general_elements[temp_0_index];
 }
 
 Element Element::operator*(int times) const {
     if (times < 0) {
         throw "FFA\\Element\\operator*(int)\\times";
     }
+    int temp_0_times = times % this->field->characteristic();
+    Element temp_1_element = *this;
     Element new_element = this->field->zero_element();
-    for (int i = 0; i < times; i ++) {
-        new_element = new_element + *this;
+    while (temp_0_times > 0) {
+        if (temp_0_times & 1) {
+            new_element = new_element + temp_1_element;
+        }
+        temp_1_element = temp_1_element + temp_1_element;
+        temp_0_times = temp_0_times >> 1;
     }
     return new_element;
 }
@@ -122,11 +159,11 @@ Element Element::operator^(int power) const {
     if (power < 0) {
         throw "FFA\\Element\\operator^(int)\\power";
     }
-    Element new_element = this->field->unit_element();
-    for (int i = 0; i < power; i ++) {
-        new_element = new_element * *this;
+    int temp_0_index = this->field->element_index(*this);
+    if (temp_0_index == this->field->size() - 1) {
+        return power == 0 ? this->field->unit_element() : this->field->zero_element();
     }
-    return new_element;
+    return this->field->general_elements[(long long) temp_0_index * power % (this->field->size() - 1)];
 }
 
 Element Element::operator-(const Element& element) const {
@@ -140,6 +177,13 @@ Element Element::operator/(const Element& element) const {
     if (*element.field != *this->field) {
         throw "FFA\\Element\\operator~(const Element&)\\element\\field";
     }
+    if (this->field->compact) {
+        if (element.bits == 0) {
+            throw "FFA\\Element\\operator~()";
+        }
+        uint32_t new_bits = this->field->divide(this->bits, element.bits);
+        return Element(this->field, new_bits);
+    }
     return (*this) * (~element);
 }
 
@@ -8,11 +8,21 @@
 #ifndef _FFA_H_
 #define _FFA_H_
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 using namespace std;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,7 +37,15 @@ class Element;
 class Field {
     public:
     Polynomial* primitive_polynomial;
+    int identity;
     vector<Element> general_elements;
+    bool compact;
+    vector<uint32_t> exponent_table;
+    vector<uint32_t> logarithm_table;
+    vector<int> position_table;
+    vector<int> inverse_table;
+    vector<int> negation_table;
+    vector<uint8_t> nibble_table;
 
     public:
     Field();
@@ -40,13 +58,23 @@ class Field {
 
     public:
     int size() const;
+    int characteristic() const;
     Element zero_element() const;
     Element unit_element() const;
     Element primitive_element() const;
+    int element_index(const Element& element) const;
+
+    public:
+    uint32_t add(uint32_t augend, uint32_t addend) const;
+    uint32_t multiply(uint32_t multiplicand, uint32_t multiplier) const;
+    uint32_t divide(uint32_t dividend, uint32_t divisor) const;
 };
 
 namespace fields {
     static Field default_field;
+    pair<int, vector<int>> key(Polynomial* primitive_polynomial);
+    int identity(Polynomial* primitive_polynomial);
+    Field* intern(Polynomial* primitive_polynomial);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,11 +84,13 @@ class Element {
     Field* field;
     bool value;
     vector<Element> values;
+    uint32_t bits;
 
     public:
     Element() = delete;
     Element(bool value);
     Element(Field* field, vector<Element> values);
+    Element(Field* field, uint32_t bits);
     ~Element() = default;
 
     public:
@@ -85,9 +115,50 @@ ostream& operator<<(ostream& output, const Element& element);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace kernels {
+    void multiply_add(const uint8_t* table, const uint8_t* source, uint8_t* destination, int size);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace compiled {
+    template<unsigned M>
+    struct Tables {
+        array<uint16_t, 2 * ((1 << M) - 1)> exponent_table;
+        array<uint16_t, (1 << M)> logarithm_table;
+        array<uint8_t, (M <= 8 ? 32 << M : 1)> nibble_table;
+    };
+
+    template<unsigned M, uint32_t Primitive>
+    constexpr Tables<M> build_tables();
+
+    template<unsigned M, uint32_t Primitive>
+    class Field {
+        static_assert(M >= 2 && M <= 16, "FFA\\compiled\\Field\\M");
+        static_assert(Primitive >> M == 1, "FFA\\compiled\\Field\\Primitive");
+
+        public:
+        typedef typename conditional<(M <= 8), uint8_t, uint16_t>::type symbol_type;
+        static constexpr int degree = M;
+        static constexpr int size = 1 << M;
+        static constexpr int order = (1 << M) - 1;
+        static constexpr Tables<M> tables = build_tables<M, Primitive>();
+
+        public:
+        static constexpr symbol_type exponent(int power);
+        static constexpr int logarithm(uint32_t element);
+        static constexpr symbol_type multiply(uint32_t multiplicand, uint32_t multiplier);
+        static constexpr symbol_type divide(uint32_t dividend, uint32_t divisor);
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #include "../Maths/maths.h"
 #include "element.cpp"
 #include "field.cpp"
+#include "kernel.cpp"
+#include "compiled.cpp"
 
 #endif
 
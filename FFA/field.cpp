@@ -12,62 +12,112 @@
 
 Field::Field() {
     this->primitive_polynomial = &polynomials::default_polynomial;
+    this->identity = 0;
     this->general_elements = {Element(true), Element(false)};
+    this->compact = false;
+    this->inverse_table = {0, -1};
+    this->negation_table = {0, 1};
 }
 
 Field::Field(Polynomial* primitive_polynomial) {
+    if (*primitive_polynomial->field == fields::default_field && primitive_polynomial->degree() > 16) {
+        throw "FFA\\Field\\Field(Polynomial*)\\primitive_polynomial\\degree";
+    }
     this->primitive_polynomial = primitive_polynomial;
-    int temp_0_size = pow(primitive_polynomial->field->size(), primitive_polynomial->degree());
-    this->general_elements = vector<Element>(temp_0_size, Element(this, vector<Element>(primitive_polynomial->degree(), primitive_polynomial->field->zero_element())));
-    vector<Element> temp_1_elements = vector<Element>(temp_0_size, Element(this, vector<Element>(primitive_polynomial->degree(), primitive_polynomial->field->zero_element())));
-    for (int i = 0; i < temp_0_size; i ++) {
-        int temp_2_index = i;
-        for (int j = primitive_polynomial->degree() - 1; j >= 0; j --) {
-            temp_1_elements[i].values[j] = primitive_polynomial->field->general_elements[temp_2_index % primitive_polynomial->field->size()];
-            temp_2_index = temp_2_index / primitive_polynomial->field->size();
+    this->identity = fields::identity(primitive_polynomial);
+    this->compact = *primitive_polynomial->field == fields::default_field;
+    if (this->compact) {
+        uint32_t temp_0_size = uint32_t(1) << primitive_polynomial->degree();
+        uint32_t temp_1_feedback = 0;
+        for (int i = 0; i < primitive_polynomial->degree(); i ++) {
+            temp_1_feedback = temp_1_feedback | (uint32_t(primitive_polynomial->coefficients[i].value) << i);
         }
-    }
-    Element temp_3_element(this, vector<Element>(primitive_polynomial->degree(), primitive_polynomial->field->zero_element()));
-    for (int i = 0; i < primitive_polynomial->degree(); i ++) {
-        temp_3_element.values[i] = primitive_polynomial->coefficients[i];
-    }
-    for (int i = 0; i < temp_0_size; i ++) {
-        if (temp_1_elements[i] + temp_1_elements[i] == temp_1_elements[i]) {
-            this->general_elements[temp_0_size - 1] = temp_1_elements[i];
+        this->exponent_table = vector<uint32_t>(2 * (temp_0_size - 1), 0);
+        this->logarithm_table = vector<uint32_t>(temp_0_size, temp_0_size);
+        uint32_t temp_2_bits = 1;
+        for (uint32_t i = 0; i < temp_0_size - 1; i ++) {
+            if (temp_2_bits == 0 || this->logarithm_table[temp_2_bits] != temp_0_size) {
+                throw "FFA\\Field\\Field(Polynomial*)";
+            }
+            this->exponent_table[i] = temp_2_bits;
+            this->exponent_table[i + temp_0_size - 1] = temp_2_bits;
+            this->logarithm_table[temp_2_bits] = i;
+            temp_2_bits = temp_2_bits << 1;
+            if (temp_2_bits & temp_0_size) {
+                temp_2_bits = temp_2_bits ^ temp_0_size ^ temp_1_feedback;
+            }
         }
-    }
-    for (int i = 0; i < temp_0_size; i ++) {
-        if (temp_1_elements[i] * temp_1_elements[i] == temp_1_elements[i] && temp_1_elements[i] != this->zero_element()) {
-            this->general_elements[0] = temp_1_elements[i];
+        if (temp_2_bits != 1) {
+            throw "FFA\\Field\\Field(Polynomial*)";
         }
-    }
-    for (int i = 0; i < temp_0_size; i ++) {
-        if ((temp_1_elements[i] ^ primitive_polynomial->degree()) == temp_3_element) {
-            this->general_elements[1] = temp_1_elements[i];
+        this->logarithm_table[0] = 0;
+        this->general_elements.reserve(temp_0_size);
+        for (uint32_t i = 0; i < temp_0_size - 1; i ++) {
+            this->general_elements.push_back(Element(this, this->exponent_table[i]));
         }
-    }
-    for (int i = 2; i < temp_0_size - 1; i ++) {
-        this->general_elements[i] = (this->primitive_element() ^ i);
-    }
-    for (int i = 0; i < temp_0_size; i ++) {
-        for (int j = i + 1; j < temp_0_size; j ++) {
-            if (this->general_elements[i] == this->general_elements[j]) {
+        this->general_elements.push_back(Element(this, uint32_t(0)));
+        if (primitive_polynomial->degree() <= 8) {
+            this->nibble_table = vector<uint8_t>(32 * temp_0_size, 0);
+            for (uint32_t i = 0; i < temp_0_size; i ++) {
+                for (uint32_t j = 0; j < 16; j ++) {
+                    this->nibble_table[32 * i + j] = j < temp_0_size ? this->multiply(i, j) : 0;
+                    this->nibble_table[32 * i + 16 + j] = (j << 4) < temp_0_size ? this->multiply(i, j << 4) : 0;
+                }
+            }
+        }
+    } else {
+        int temp_0_size = pow(primitive_polynomial->field->size(), primitive_polynomial->degree());
+        Field* temp_1_field = primitive_polynomial->field;
+        vector<Element> temp_2_feedback(primitive_polynomial->degree(), temp_1_field->zero_element());
+        Element temp_3_leading = ~primitive_polynomial->coefficients[primitive_polynomial->degree()];
+        for (int i = 0; i < primitive_polynomial->degree(); i ++) {
+            temp_2_feedback[i] = -(primitive_polynomial->coefficients[i] * temp_3_leading);
+        }
+        vector<Element> temp_4_unit(primitive_polynomial->degree(), temp_1_field->zero_element());
+        temp_4_unit[0] = temp_1_field->unit_element();
+        vector<Element> temp_5_values = temp_4_unit;
+        this->general_elements.reserve(temp_0_size);
+        for (int i = 0; i < temp_0_size - 1; i ++) {
+            if (i != 0 && temp_5_values == temp_4_unit) {
                 throw "FFA\\Field\\Field(Polynomial*)";
             }
+            this->general_elements.push_back(Element(this, temp_5_values));
+            Element temp_6_carry = temp_5_values[primitive_polynomial->degree() - 1];
+            for (int j = primitive_polynomial->degree() - 1; j > 0; j --) {
+                temp_5_values[j] = temp_5_values[j - 1] + temp_6_carry * temp_2_feedback[j];
+            }
+            temp_5_values[0] = temp_6_carry * temp_2_feedback[0];
+        }
+        if (temp_5_values != temp_4_unit) {
+            throw "FFA\\Field\\Field(Polynomial*)";
+        }
+        this->general_elements.push_back(Element(this, vector<Element>(primitive_polynomial->degree(), temp_1_field->zero_element())));
+        this->position_table = vector<int>(temp_0_size, 0);
+        for (int i = 0; i < temp_0_size; i ++) {
+            int temp_7_code = 0;
+            for (int j = primitive_polynomial->degree() - 1; j >= 0; j --) {
+                temp_7_code = temp_7_code * temp_1_field->size() + temp_1_field->element_index(this->general_elements[i].values[j]);
+            }
+            this->position_table[temp_7_code] = i;
         }
     }
+    int temp_8_index = this->size() % 2 == 0 ? 0 : (this->size() - 1) / 2;
+    this->inverse_table = vector<int>(this->size(), -1);
+    this->negation_table = vector<int>(this->size(), this->size() - 1);
+    for (int i = 0; i < this->size() - 1; i ++) {
+        this->inverse_table[i] = (this->size() - 1 - i) % (this->size() - 1);
+        this->negation_table[i] = (i + temp_8_index) % (this->size() - 1);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool Field::operator==(const Field& field) const {
-    if (this == &fields::default_field && &field != &fields::default_field || this != &fields::default_field && &field == &fields::default_field) return false;
-    if (this->primitive_polynomial == field.primitive_polynomial) return true;
-    return *this->primitive_polynomial == *field.primitive_polynomial;
+    return this->identity == field.identity;
 }
 
 bool Field::operator!=(const Field& field) const {
-    return !(*this == field);
+    return this->identity != field.identity;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,5 +138,85 @@ Element Field::primitive_element() const {
     return this->general_elements[1];
 }
 
+int Field::characteristic() const {
+    if (this == &fields::default_field) return 2;
+    return this->primitive_polynomial->field->characteristic();
+}
+
+int Field::element_index(const Element& element) const {
+    if (this == &fields::default_field) {
+        return element.value ? 0 : 1;
+    } else if (this->compact) {
+        return element.bits == 0 ? this->size() - 1 : this->logarithm_table[element.bits];
+    }
+    int new_code = 0;
+    for (int i = element.values.size() - 1; i >= 0; i --) {
+        new_code = new_code * this->primitive_polynomial->field->size() + this->primitive_polynomial->field->element_index(element.values[i]);
+    }
+    return this->position_table[new_code];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t Field::add(uint32_t augend, uint32_t addend) const {
+    return augend ^ addend;
+}
+
+uint32_t Field::multiply(uint32_t multiplicand, uint32_t multiplier) const {
+    if (multiplicand == 0 || multiplier == 0) return 0;
+    return this->exponent_table[this->logarithm_table[multiplicand] + this->logarithm_table[multiplier]];
+}
+
+uint32_t Field::divide(uint32_t dividend, uint32_t divisor) const {
+    if (divisor == 0) {
+        throw "FFA\\Field\\divide(uint32_t, uint32_t)\\divisor";
+    }
+    if (dividend == 0) return 0;
+    return this->exponent_table[this->logarithm_table[dividend] + this->size() - 1 - this->logarithm_table[divisor]];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace fields {
+    static recursive_mutex registry_lock;
+    static map<pair<int, vector<int>>, int> registry_identities;
+    static map<pair<int, vector<int>>, Field*> registry_fields;
+    static list<Polynomial> registry_polynomials;
+    static list<Field> registry_storage;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+pair<int, vector<int>> fields::key(Polynomial* primitive_polynomial) {
+    Field* temp_0_field = primitive_polynomial->field;
+    vector<int> new_indices(primitive_polynomial->degree() + 1);
+    for (int i = 0; i <= primitive_polynomial->degree(); i ++) {
+        new_indices[i] = temp_0_field->element_index(primitive_polynomial->coefficients[i]);
+    }
+    return {temp_0_field->identity, new_indices};
+}
+
+int fields::identity(Polynomial* primitive_polynomial) {
+    pair<int, vector<int>> temp_0_key = fields::key(primitive_polynomial);
+    lock_guard<recursive_mutex> temp_1_guard(fields::registry_lock);
+    auto temp_2_found = fields::registry_identities.find(temp_0_key);
+    if (temp_2_found != fields::registry_identities.end()) return temp_2_found->second;
+    int new_identity = fields::registry_identities.size() + 1;
+    fields::registry_identities.emplace(temp_0_key, new_identity);
+    return new_identity;
+}
+
+Field* fields::intern(Polynomial* primitive_polynomial) {
+    pair<int, vector<int>> temp_0_key = fields::key(primitive_polynomial);
+    lock_guard<recursive_mutex> temp_1_guard(fields::registry_lock);
+    auto temp_2_found = fields::registry_fields.find(temp_0_key);
+    if (temp_2_found != fields::registry_fields.end()) return temp_2_found->second;
+    fields::registry_polynomials.push_back(*primitive_polynomial);
+    fields::registry_storage.emplace_back(&fields::registry_polynomials.back());
+    fields::registry_fields.emplace(temp_0_key, &fields::registry_storage.back());
+    return &fields::registry_storage.back();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
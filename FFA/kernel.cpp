@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: kernel.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ffa.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kernels {
+    void multiply_add_scalar(const uint8_t* table, const uint8_t* source, uint8_t* destination, int size) {
+        for (int i = 0; i < size; i ++) {
+            destination[i] = destination[i] ^ table[source[i] & 0x0f] ^ table[16 + (source[i] >> 4)];
+        }
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    __attribute__((target("ssse3")))
+    void multiply_add_ssse3(const uint8_t* table, const uint8_t* source, uint8_t* destination, int size) {
+        __m128i temp_0_low = _mm_loadu_si128((const __m128i*) table);
+        __m128i temp_1_high = _mm_loadu_si128((const __m128i*) (table + 16));
+        __m128i temp_2_mask = _mm_set1_epi8(0x0f);
+        int i = 0;
+        for (; i + 16 <= size; i += 16) {
+            __m128i temp_3_source = _mm_loadu_si128((const __m128i*) (source + i));
+            __m128i temp_4_low = _mm_shuffle_epi8(temp_0_low, _mm_and_si128(temp_3_source, temp_2_mask));
+            __m128i temp_5_high = _mm_shuffle_epi8(temp_1_high, _mm_and_si128(_mm_srli_epi64(temp_3_source, 4), temp_2_mask));
+            __m128i temp_6_destination = _mm_loadu_si128((const __m128i*) (destination + i));
+            _mm_storeu_si128((__m128i*) (destination + i), _mm_xor_si128(temp_6_destination, _mm_xor_si128(temp_4_low, temp_5_high)));
+        }
+        multiply_add_scalar(table, source + i, destination + i, size - i);
+    }
+
+    __attribute__((target("avx2")))
+    void multiply_add_avx2(const uint8_t* table, const uint8_t* source, uint8_t* destination, int size) {
+        __m256i temp_0_low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) table));
+        __m256i temp_1_high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) (table + 16)));
+        __m256i temp_2_mask = _mm256_set1_epi8(0x0f);
+        int i = 0;
+        for (; i + 32 <= size; i += 32) {
+            __m256i temp_3_source = _mm256_loadu_si256((const __m256i*) (source + i));
+            __m256i temp_4_low = _mm256_shuffle_epi8(temp_0_low, _mm256_and_si256(temp_3_source, temp_2_mask));
+            __m256i temp_5_high = _mm256_shuffle_epi8(temp_1_high, _mm256_and_si256(_mm256_srli_epi64(temp_3_source, 4), temp_2_mask));
+            __m256i temp_6_destination = _mm256_loadu_si256((const __m256i*) (destination + i));
+            _mm256_storeu_si256((__m256i*) (destination + i), _mm256_xor_si256(temp_6_destination, _mm256_xor_si256(temp_4_low, temp_5_high)));
+        }
+        _mm256_zeroupper();
+        multiply_add_ssse3(table, source + i, destination + i, size - i);
+    }
+#endif
+
+    void multiply_add(const uint8_t* table, const uint8_t* source, uint8_t* destination, int size) {
+#if defined(__x86_64__) || defined(__i386__)
+        static void (*kernel)(const uint8_t*, const uint8_t*, uint8_t*, int) = __builtin_cpu_supports("avx2") ? multiply_add_avx2 : __builtin_cpu_supports("ssse3") ? multiply_add_ssse3 : multiply_add_scalar;
+#else
+        static void (*kernel)(const uint8_t*, const uint8_t*, uint8_t*, int) = multiply_add_scalar;
+#endif
+        kernel(table, source, destination, size);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -9,6 +9,7 @@
 #define _MATHS_H_
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@ class Field;
 class Element;
 class Polynomial;
 class Matrix;
+class Slice;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -32,9 +34,16 @@ class Polynomial {
 
     public:
     Polynomial();
-    Polynomial(Field* field, vector<Element> coefficients);
+    Polynomial(Field* field, const vector<Element>& coefficients);
+    Polynomial(Field* field, vector<Element>&& coefficients);
+    Polynomial(const Polynomial& polynomial) = default;
+    Polynomial(Polynomial&& polynomial) = default;
     ~Polynomial() = default;
 
+    public:
+    Polynomial& operator=(const Polynomial& polynomial) = default;
+    Polynomial& operator=(Polynomial&& polynomial) = default;
+
     public:
     bool operator==(const Polynomial& polynomial) const;
     bool operator!=(const Polynomial& polynomial) const;
@@ -46,6 +55,13 @@ class Polynomial {
     Polynomial operator/(const Polynomial& polynomial) const;
     Polynomial operator%(const Polynomial& polynomial) const;
 
+    public:
+    Polynomial& operator+=(const Polynomial& polynomial);
+    Polynomial& operator-=(const Polynomial& polynomial);
+    Polynomial& operator*=(const Element& scalar);
+    Polynomial& multiply_add(const Polynomial& polynomial, const Element& scalar, int shift = 0);
+    void divmod(const Polynomial& divisor, Polynomial& quotient, Polynomial& remainder) const;
+
     public:
     int degree() const;
     Polynomial redegree(int degree) const;
@@ -53,13 +69,22 @@ class Polynomial {
 
     public:
     Element evaluate(const Element& argument) const;
+    void evaluate(const vector<Element>& arguments, vector<Element>& results) const;
     Polynomial derivative() const;
 };
 
 ostream& operator<<(ostream& output, const Polynomial& polynomial);
+void evaluate(const vector<Polynomial>& polynomials, const Element& argument, vector<Element>& results);
 
 namespace polynomials {
     static Polynomial default_polynomial;
+    static int karatsuba_threshold = 32;
+    static int transform_threshold = 3072;
+    static int half_gcd_threshold = 32;
+    void schoolbook_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product);
+    void karatsuba_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product);
+    void transform_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product);
+    void multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,11 +92,14 @@ namespace polynomials {
 class Matrix {
     public:
     Field* field;
-    vector<vector<Element>> elements;
+    int rows;
+    int columns;
+    vector<Element> elements;
 
     public:
     Matrix() = delete;
     Matrix(Field* field, vector<vector<Element>> elements);
+    Matrix(Field* field, int row, int column);
     ~Matrix() = default;
 
     public:
@@ -87,19 +115,55 @@ class Matrix {
     public:
     int row() const;
     int column() const;
+    Element& at(int row, int column);
+    const Element& at(int row, int column) const;
     Matrix resize(int row, int column) const;
+    Slice slice(int row, int column, int rows, int columns) const;
 
     public:
     Matrix transpose() const;
     Element determinant() const;
+    int rank() const;
+    Matrix& invert();
+
+    public:
+    void decompose(Matrix& lower_upper, vector<int>& permutation) const;
+    Matrix solve(const Matrix& matrix) const;
 };
 
 ostream& operator<<(ostream& output, const Matrix& matrix);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+class Slice {
+    public:
+    const Matrix* matrix;
+    int row_offset;
+    int column_offset;
+    int rows;
+    int columns;
+
+    public:
+    Slice() = delete;
+    Slice(const Matrix* matrix, int row, int column, int rows, int columns);
+    ~Slice() = default;
+
+    public:
+    int row() const;
+    int column() const;
+    const Element& at(int row, int column) const;
+    Matrix copy() const;
+
+    public:
+    Matrix operator*(const Slice& slice) const;
+    Matrix operator*(const Matrix& matrix) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #include "../FFA/ffa.h"
 #include "matrix.cpp"
+#include "slice.cpp"
 #include "polynomial.cpp"
 
 #endif
@@ -24,12 +24,30 @@ Matrix::Matrix(Field* field, vector<vector<Element>> elements) {
         }
     }
     this->field = field;
-    this->elements = elements;
+    this->rows = elements.size();
+    this->columns = elements.empty() ? 0 : elements[0].size();
+    this->elements.reserve(this->rows * this->columns);
+    for (int i = 0; i < this->rows; i ++) {
+        this->elements.insert(this->elements.end(), elements[i].begin(), elements[i].end());
+    }
+}
+
+Matrix::Matrix(Field* field, int row, int column) {
+    if (row < 0) {
+        throw "Maths\\Matrix\\Matrix(Field*, int, int)\\row";
+    } else if (column < 0) {
+        throw "Maths\\Matrix\\Matrix(Field*, int, int)\\column";
+    }
+    this->field = field;
+    this->rows = row;
+    this->columns = column;
+    this->elements = vector<Element>(row * column, field->zero_element());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool Matrix::operator==(const Matrix& matrix) const {
+    if (this->rows != matrix.rows || this->columns != matrix.columns) return false;
     if (this->field == matrix.field && this->elements == matrix.elements) return true;
     return *this->field == *matrix.field && this->elements == matrix.elements;
 }
@@ -43,7 +61,7 @@ ostream& operator<<(ostream& output, const Matrix& matrix) {
     for (int i = 0; i < matrix.row(); i ++) {
         output << "{";
         for (int j = 0; j < matrix.column(); j ++) {
-            output << matrix.elements[i][j];
+            output << matrix.at(i, j);
             if (j != matrix.column() - 1) {
                 output << ", ";
             }
@@ -60,11 +78,19 @@ ostream& operator<<(ostream& output, const Matrix& matrix) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int Matrix::row() const {
-    return this->elements.size();
+    return this->rows;
 }
 
 int Matrix::column() const {
-    return this->elements[0].size();
+    return this->columns;
+}
+
+Element& Matrix::at(int row, int column) {
+    return this->elements[row * this->columns + column];
+}
+
+const Element& Matrix::at(int row, int column) const {
+    return this->elements[row * this->columns + column];
 }
 
 Matrix Matrix::resize(int row, int column) const {
@@ -73,54 +99,23 @@ Matrix Matrix::resize(int row, int column) const {
     } else if (column <= 0) {
         throw "Maths\\Matrix\\resize(int, int)\\column";
     }
-    vector<vector<Element>> new_elements(row, vector<Element>(column, this->field->zero_element()));
+    Matrix new_matrix(this->field, row, column);
     for (int i = 0; i < min(row, this->row()); i ++) {
-        for (int j = 0; j < min(column, this->column()); j ++) {
-            new_elements[i][j] = this->elements[i][j];
-        }
+        copy_n(&this->at(i, 0), min(column, this->column()), &new_matrix.at(i, 0));
     }
-    return Matrix(this->field, new_elements);
+    return new_matrix;
+}
+
+Slice Matrix::slice(int row, int column, int rows, int columns) const {
+    return Slice(this, row, column, rows, columns);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 Matrix Matrix::operator~() const {
-    if (this->row() != this->column() || this->determinant() == this->field->zero_element()) {
-        throw "Maths\\Matrix\\operator~()";
-    }
-    vector<vector<Element>> new_elements(this->row(), vector<Element>(this->column(), this->field->zero_element()));
-    for (int i = 0; i < this->row(); i ++) {
-        new_elements[i][i] = this->field->unit_element();
-    }
-    vector<vector<Element>> temp_0_elements = this->elements;
-    for (int i = 0; i < this->row(); i ++) {
-        if (temp_0_elements[i][i] == this->field->zero_element()) {
-            for (int j = i + 1; j < this->row(); j ++) {
-                if (temp_0_elements[j][i] != this->field->zero_element()) {
-                    swap(temp_0_elements[i], temp_0_elements[j]);
-                    swap(new_elements[i], new_elements[j]);
-                    break;
-                }
-                if (j == this->row() - 1) throw "ERROR 8712";
-            }
-        }
-        Element temp_1_diagonal = temp_0_elements[i][i];
-        for (int j = 0; j < this->row(); j ++) {
-            temp_0_elements[i][j] = temp_0_elements[i][j] / temp_1_diagonal;
-            new_elements[i][j] = new_elements[i][j] / temp_1_diagonal;
-        }
-        for (int j = 0; j < this->row(); j ++) {
-            if (j != i) {
-                Element temp_2_factor = temp_0_elements[j][i];
-                for (int k = 0; k < this->row(); k ++) {
-                    temp_0_elements[j][k] = temp_0_elements[j][k] - (temp_2_factor * temp_0_elements[i][k]);
-                    new_elements[j][k] = new_elements[j][k] - (temp_2_factor * new_elements[i][k]);
-                }
-            }
-        }
-    }
-    return Matrix(this->field, new_elements);
+    Matrix new_matrix = *this;
+    return new_matrix.invert();
 }
 
 Matrix Matrix::operator+(const Matrix& matrix) const {
@@ -131,15 +126,11 @@ Matrix Matrix::operator+(const Matrix& matrix) const {
     } else if (matrix.column() != this->column()) {
         throw "Maths\\Matrix\\operator+(const Matrix&)\\matrix\\column";
     }
-    int new_row = this->row();
-    int new_column = this->column();
-    vector<vector<Element>> new_elements(new_row, vector<Element>(new_column, this->field->zero_element()));
-    for (int i = 0; i < new_row; i ++) {
-        for (int j = 0; j < new_column; j ++) {
-            new_elements[i][j] = this->elements[i][j] + matrix.elements[i][j];
-        }
+    Matrix new_matrix(this->field, this->row(), this->column());
+    for (int i = 0; i < this->elements.size(); i ++) {
+        new_matrix.elements[i] = this->elements[i] + matrix.elements[i];
     }
-    return Matrix(this->field, new_elements);
+    return new_matrix;
 }
 
 Matrix Matrix::operator*(const Matrix& matrix) const {
@@ -148,31 +139,17 @@ Matrix Matrix::operator*(const Matrix& matrix) const {
     } else if (matrix.row() != this->column()) {
         throw "Maths\\Matrix\\operator*(const Matrix&)\\matrix\\row";
     }
-    int new_row = this->row();
-    int new_column = matrix.column();
-    vector<vector<Element>> new_elements(new_row, vector<Element>(new_column, this->field->zero_element()));
-    for (int i = 0; i < new_row; i ++) {
-        for (int j = 0; j < new_column; j ++) {
-            for (int k = 0; k < this->column(); k ++) {
-                new_elements[i][j] = new_elements[i][j] + (this->elements[i][k] * matrix.elements[k][j]);
-            }
-        }
-    }
-    return Matrix(this->field, new_elements);
+    return this->slice(0, 0, this->row(), this->column()) * matrix.slice(0, 0, matrix.row(), matrix.column());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 Matrix Matrix::operator-() const {
-    int new_row = this->row();
-    int new_column = this->column();
-    vector<vector<Element>> new_elements(new_row, vector<Element>(new_column, this->field->zero_element()));
-    for (int i = 0; i < new_row; i ++) {
-        for (int j = 0; j < new_column; j ++) {
-            new_elements[i][j] = -this->elements[i][j];
-        }
+    Matrix new_matrix(this->field, this->row(), this->column());
+    for (int i = 0; i < this->elements.size(); i ++) {
+        new_matrix.elements[i] = -this->elements[i];
     }
-    return Matrix(this->field, new_elements);
+    return new_matrix;
 }
 
 Matrix Matrix::operator-(const Matrix& matrix) const {
@@ -192,53 +169,200 @@ Matrix Matrix::operator*(const Element& scalar) const {
     if (scalar.field != this->field) {
         throw "Maths\\Matrix\\operator*(const Element&)\\scalar\\field";
     }
-    int new_row = this->row();
-    int new_column = this->column();
-    vector<vector<Element>> new_elements(new_row, vector<Element>(new_column, this->field->zero_element()));
-    for (int i = 0; i < new_row; i ++) {
-        for (int j = 0; j < new_column; j ++) {
-            new_elements[i][j] = this->elements[i][j] * scalar;
-        }
+    Matrix new_matrix(this->field, this->row(), this->column());
+    for (int i = 0; i < this->elements.size(); i ++) {
+        new_matrix.elements[i] = this->elements[i] * scalar;
     }
-    return Matrix(this->field, new_elements);
+    return new_matrix;
 }
 
 Matrix Matrix::transpose() const {
-    int new_row = this->column();
-    int new_column = this->row();
-    vector<vector<Element>> new_elements(new_row, vector<Element>(new_column, this->field->zero_element()));
-    for (int i = 0; i < new_row; i ++) {
-        for (int j = 0; j < new_column; j ++) {
-            new_elements[i][j] = this->elements[j][i];
+    Matrix new_matrix(this->field, this->column(), this->row());
+    for (int i = 0; i < new_matrix.row(); i ++) {
+        for (int j = 0; j < new_matrix.column(); j ++) {
+            new_matrix.at(i, j) = this->at(j, i);
         }
     }
-    return Matrix(this->field, new_elements);
+    return new_matrix;
 }
 
 Element Matrix::determinant() const {
     if (this->row() != this->column()) {
         throw "Maths\\Matrix\\determinant()";
     }
-    vector<int> temp_0_permutation(this->row());
+    Matrix temp_0_matrix = *this;
+    Element new_element = this->field->unit_element();
     for (int i = 0; i < this->row(); i ++) {
-        temp_0_permutation[i] = i;
-    }
-    Element new_element = this->field->zero_element();
-    bool temp_1_sign = false;
-    do {
-        Element temp_2_element = this->field->unit_element();
-        for (int i = 0; i < this->row(); i ++) {
-            temp_2_element = temp_2_element * this->elements[i][temp_0_permutation[i]];
-        }
-        temp_1_sign = !temp_1_sign;
-        if (temp_1_sign) {
-            new_element = new_element + temp_2_element;
-        } else {
-            new_element = new_element - temp_2_element;
-        }
-    } while (next_permutation(temp_0_permutation.begin(), temp_0_permutation.end()));
+        int temp_1_pivot = i;
+        while (temp_1_pivot < this->row() && temp_0_matrix.at(temp_1_pivot, i) == this->field->zero_element()) {
+            temp_1_pivot ++;
+        }
+        if (temp_1_pivot == this->row()) return this->field->zero_element();
+        if (temp_1_pivot != i) {
+            swap_ranges(&temp_0_matrix.at(i, 0), &temp_0_matrix.at(i, 0) + this->column(), &temp_0_matrix.at(temp_1_pivot, 0));
+            new_element = -new_element;
+        }
+        new_element = new_element * temp_0_matrix.at(i, i);
+        Element temp_2_inverse = ~temp_0_matrix.at(i, i);
+        for (int j = i + 1; j < this->row(); j ++) {
+            if (temp_0_matrix.at(j, i) == this->field->zero_element()) continue;
+            Element temp_3_factor = temp_0_matrix.at(j, i) * temp_2_inverse;
+            for (int k = i + 1; k < this->column(); k ++) {
+                temp_0_matrix.at(j, k) = temp_0_matrix.at(j, k) - temp_3_factor * temp_0_matrix.at(i, k);
+            }
+        }
+    }
     return new_element;
 }
 
+int Matrix::rank() const {
+    Matrix temp_0_matrix = *this;
+    int new_rank = 0;
+    for (int i = 0; i < this->column() && new_rank < this->row(); i ++) {
+        int temp_1_pivot = new_rank;
+        while (temp_1_pivot < this->row() && temp_0_matrix.at(temp_1_pivot, i) == this->field->zero_element()) {
+            temp_1_pivot ++;
+        }
+        if (temp_1_pivot == this->row()) continue;
+        swap_ranges(&temp_0_matrix.at(new_rank, 0), &temp_0_matrix.at(new_rank, 0) + this->column(), &temp_0_matrix.at(temp_1_pivot, 0));
+        Element temp_2_inverse = ~temp_0_matrix.at(new_rank, i);
+        for (int j = new_rank + 1; j < this->row(); j ++) {
+            if (temp_0_matrix.at(j, i) == this->field->zero_element()) continue;
+            Element temp_3_factor = temp_0_matrix.at(j, i) * temp_2_inverse;
+            for (int k = i + 1; k < this->column(); k ++) {
+                temp_0_matrix.at(j, k) = temp_0_matrix.at(j, k) - temp_3_factor * temp_0_matrix.at(new_rank, k);
+            }
+        }
+        new_rank ++;
+    }
+    return new_rank;
+}
+
+Matrix& Matrix::invert() {
+    if (this->row() != this->column()) {
+        throw "Maths\\Matrix\\invert()";
+    }
+    int temp_0_size = this->row();
+    vector<int> temp_1_pivots(temp_0_size);
+    for (int i = 0; i < temp_0_size; i ++) {
+        int temp_2_pivot = i;
+        while (temp_2_pivot < temp_0_size && this->at(temp_2_pivot, i) == this->field->zero_element()) {
+            temp_2_pivot ++;
+        }
+        if (temp_2_pivot == temp_0_size) {
+            throw "Maths\\Matrix\\invert()";
+        }
+        temp_1_pivots[i] = temp_2_pivot;
+        if (temp_2_pivot != i) {
+            swap_ranges(&this->at(i, 0), &this->at(i, 0) + temp_0_size, &this->at(temp_2_pivot, 0));
+        }
+        if (this->field->compact) {
+            Element* temp_3_row = &this->at(i, 0);
+            uint32_t temp_4_inverse = this->field->divide(1, temp_3_row[i].bits);
+            temp_3_row[i].bits = 1;
+            for (int k = 0; k < temp_0_size; k ++) {
+                temp_3_row[k].bits = this->field->multiply(temp_3_row[k].bits, temp_4_inverse);
+            }
+            for (int j = 0; j < temp_0_size; j ++) {
+                Element* temp_5_row = &this->at(j, 0);
+                if (j == i || temp_5_row[i].bits == 0) continue;
+                uint32_t temp_6_factor = temp_5_row[i].bits;
+                temp_5_row[i].bits = 0;
+                for (int k = 0; k < temp_0_size; k ++) {
+                    temp_5_row[k].bits = temp_5_row[k].bits ^ this->field->multiply(temp_6_factor, temp_3_row[k].bits);
+                }
+            }
+            continue;
+        }
+        Element temp_3_inverse = ~this->at(i, i);
+        this->at(i, i) = this->field->unit_element();
+        for (int k = 0; k < temp_0_size; k ++) {
+            this->at(i, k) = this->at(i, k) * temp_3_inverse;
+        }
+        for (int j = 0; j < temp_0_size; j ++) {
+            if (j == i || this->at(j, i) == this->field->zero_element()) continue;
+            Element temp_4_factor = this->at(j, i);
+            this->at(j, i) = this->field->zero_element();
+            for (int k = 0; k < temp_0_size; k ++) {
+                this->at(j, k) = this->at(j, k) - temp_4_factor * this->at(i, k);
+            }
+        }
+    }
+    for (int i = temp_0_size - 1; i >= 0; i --) {
+        if (temp_1_pivots[i] == i) continue;
+        for (int j = 0; j < temp_0_size; j ++) {
+            swap(this->at(j, i), this->at(j, temp_1_pivots[i]));
+        }
+    }
+    return *this;
+}
+
+void Matrix::decompose(Matrix& lower_upper, vector<int>& permutation) const {
+    if (this->row() != this->column()) {
+        throw "Maths\\Matrix\\decompose(Matrix&, vector<int>&)";
+    }
+    lower_upper = *this;
+    permutation = vector<int>(this->row());
+    for (int i = 0; i < this->row(); i ++) {
+        permutation[i] = i;
+    }
+    for (int i = 0; i < this->row(); i ++) {
+        int temp_0_pivot = i;
+        while (temp_0_pivot < this->row() && lower_upper.at(temp_0_pivot, i) == this->field->zero_element()) {
+            temp_0_pivot ++;
+        }
+        if (temp_0_pivot == this->row()) continue;
+        swap_ranges(&lower_upper.at(i, 0), &lower_upper.at(i, 0) + this->column(), &lower_upper.at(temp_0_pivot, 0));
+        swap(permutation[i], permutation[temp_0_pivot]);
+        Element temp_1_inverse = ~lower_upper.at(i, i);
+        for (int j = i + 1; j < this->row(); j ++) {
+            if (lower_upper.at(j, i) == this->field->zero_element()) continue;
+            lower_upper.at(j, i) = lower_upper.at(j, i) * temp_1_inverse;
+            for (int k = i + 1; k < this->column(); k ++) {
+                lower_upper.at(j, k) = lower_upper.at(j, k) - lower_upper.at(j, i) * lower_upper.at(i, k);
+            }
+        }
+    }
+}
+
+Matrix Matrix::solve(const Matrix& matrix) const {
+    if (*matrix.field != *this->field) {
+        throw "Maths\\Matrix\\solve(const Matrix&)\\matrix\\field";
+    } else if (matrix.row() != this->row()) {
+        throw "Maths\\Matrix\\solve(const Matrix&)\\matrix\\row";
+    }
+    Matrix temp_0_lower_upper = *this;
+    vector<int> temp_1_permutation;
+    this->decompose(temp_0_lower_upper, temp_1_permutation);
+    for (int i = 0; i < this->row(); i ++) {
+        if (temp_0_lower_upper.at(i, i) == this->field->zero_element()) {
+            throw "Maths\\Matrix\\solve(const Matrix&)";
+        }
+    }
+    Matrix new_matrix(this->field, this->row(), matrix.column());
+    for (int i = 0; i < this->row(); i ++) {
+        copy_n(&matrix.at(temp_1_permutation[i], 0), matrix.column(), &new_matrix.at(i, 0));
+        for (int k = 0; k < i; k ++) {
+            if (temp_0_lower_upper.at(i, k) == this->field->zero_element()) continue;
+            for (int j = 0; j < matrix.column(); j ++) {
+                new_matrix.at(i, j) = new_matrix.at(i, j) - temp_0_lower_upper.at(i, k) * new_matrix.at(k, j);
+            }
+        }
+    }
+    for (int i = this->row() - 1; i >= 0; i --) {
+        for (int k = i + 1; k < this->row(); k ++) {
+            if (temp_0_lower_upper.at(i, k) == this->field->zero_element()) continue;
+            for (int j = 0; j < matrix.column(); j ++) {
+                new_matrix.at(i, j) = new_matrix.at(i, j) - temp_0_lower_upper.at(i, k) * new_matrix.at(k, j);
+            }
+        }
+        Element temp_2_inverse = ~temp_0_lower_upper.at(i, i);
+        for (int j = 0; j < matrix.column(); j ++) {
+            new_matrix.at(i, j) = new_matrix.at(i, j) * temp_2_inverse;
+        }
+    }
+    return new_matrix;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -15,19 +15,32 @@ Polynomial::Polynomial() {
     this->coefficients = vector<Element>();
 }
 
-Polynomial::Polynomial(Field* field, vector<Element> coefficients) {
+Polynomial::Polynomial(Field* field, const vector<Element>& coefficients) {
     if (coefficients.size() == 0) {
-        throw "Maths\\Polynomial\\Polynomial(Field*, vector<Element>)\\coefficients\\size";
+        throw "Maths\\Polynomial\\Polynomial(Field*, const vector<Element>&)\\coefficients\\size";
     }
     for (int i = 0; i < coefficients.size(); i ++) {
         if (*coefficients[i].field != *field) {
-            throw "Maths\\Polynomial\\Polynomial(Field*, vector<Element>)\\coefficients\\field";
+            throw "Maths\\Polynomial\\Polynomial(Field*, const vector<Element>&)\\coefficients\\field";
         }
     }
     this->field = field;
     this->coefficients = coefficients;
 }
 
+Polynomial::Polynomial(Field* field, vector<Element>&& coefficients) {
+    if (coefficients.size() == 0) {
+        throw "Maths\\Polynomial\\Polynomial(Field*, vector<Element>&&)\\coefficients\\size";
+    }
+    for (int i = 0; i < coefficients.size(); i ++) {
+        if (*coefficients[i].field != *field) {
+            throw "Maths\\Polynomial\\Polynomial(Field*, vector<Element>&&)\\coefficients\\field";
+        }
+    }
+    this->field = field;
+    this->coefficients = move(coefficients);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool Polynomial::operator==(const Polynomial& polynomial) const {
@@ -55,6 +68,12 @@ ostream& operator<<(ostream& output, const Polynomial& polynomial) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int Polynomial::degree() const {
+    if (this->field->compact) {
+        for (int i = this->coefficients.size() - 1; i > 0; i --) {
+            if (this->coefficients[i].bits != 0) return i;
+        }
+        return 0;
+    }
     for (int i = 0; i < this->coefficients.size(); i ++) {
         if (this->coefficients[this->coefficients.size() - i - 1] != this->field->zero_element()) {
             return this->coefficients.size() - i - 1;
@@ -73,7 +92,7 @@ Polynomial Polynomial::redegree(int degree) const {
     for (int i = 0; i <= min(degree, this->degree()); i ++) {
         new_coefficients[i] = this->coefficients[i];
     }
-    return Polynomial(this->field, new_coefficients);
+    return Polynomial(this->field, move(new_coefficients));
 }
 
 Polynomial Polynomial::align() const {
@@ -95,13 +114,9 @@ Polynomial Polynomial::operator+(const Polynomial& polynomial) const {
         throw "Maths\\Polynomial\\operator+(const Polynomial&)\\polynomial\\field";
     }
     int new_degree = max(this->degree(), polynomial.degree());
-    Polynomial temp_0_polynomial = this->redegree(new_degree);
-    Polynomial temp_1_polynomial = polynomial.redegree(new_degree);
-    vector<Element> new_coefficients(new_degree + 1, this->field->zero_element());
-    for (int i = 0; i <= new_degree; i ++) {
-        new_coefficients[i] = temp_0_polynomial.coefficients[i] + temp_1_polynomial.coefficients[i];
-    }
-    return Polynomial(this->field, new_coefficients);
+    Polynomial new_polynomial = this->redegree(new_degree);
+    new_polynomial += polynomial;
+    return new_polynomial;
 }
 
 Polynomial Polynomial::operator*(const Polynomial& polynomial) const {
@@ -113,6 +128,23 @@ Polynomial Polynomial::operator*(const Polynomial& polynomial) const {
         throw "Maths\\Polynomial\\operator*(const Polynomial&)\\polynomial\\field";
     }
     int new_degree = this->degree() + polynomial.degree();
+    if (this->field->compact) {
+        vector<uint32_t> temp_0_bits(this->degree() + 1);
+        vector<uint32_t> temp_1_bits(polynomial.degree() + 1);
+        vector<uint32_t> temp_2_bits(new_degree + 1);
+        for (int i = 0; i < temp_0_bits.size(); i ++) {
+            temp_0_bits[i] = this->coefficients[i].bits;
+        }
+        for (int i = 0; i < temp_1_bits.size(); i ++) {
+            temp_1_bits[i] = polynomial.coefficients[i].bits;
+        }
+        polynomials::multiply(this->field, temp_0_bits.data(), temp_0_bits.size(), temp_1_bits.data(), temp_1_bits.size(), temp_2_bits.data());
+        vector<Element> new_coefficients(new_degree + 1, this->field->zero_element());
+        for (int i = 0; i <= new_degree; i ++) {
+            new_coefficients[i].bits = temp_2_bits[i];
+        }
+        return Polynomial(this->field, move(new_coefficients));
+    }
     Polynomial temp_0_polynomial = this->align();
     Polynomial temp_1_polynomial = polynomial.align();
     vector<Element> new_coefficients(new_degree + 1, this->field->zero_element());
@@ -121,7 +153,7 @@ Polynomial Polynomial::operator*(const Polynomial& polynomial) const {
             new_coefficients[i + j] = new_coefficients[i + j] + (temp_0_polynomial.coefficients[i] * temp_1_polynomial.coefficients[j]);
         }
     }
-    return Polynomial(this->field, new_coefficients);
+    return Polynomial(this->field, move(new_coefficients));
 }
 
 Polynomial Polynomial::operator/(const Polynomial& polynomial) const {
@@ -132,16 +164,10 @@ Polynomial Polynomial::operator/(const Polynomial& polynomial) const {
     } else if (polynomial.field != this->field) {
         throw "Maths\\Polynomial\\operator/(const Polynomial&)\\polynomial\\field";
     }
-    int new_degree = this->degree() - polynomial.degree();
-    if (new_degree < 0) return Polynomial(this->field, {this->field->zero_element()});
-    Polynomial temp_0_polynomial = this->align();
-    Polynomial temp_1_polynomial = polynomial.align();
-    vector<Element> new_coefficients(new_degree + 1, this->field->zero_element());
-    for (int i = 0; i <= new_degree; i ++) {
-        new_coefficients[new_degree - i] = temp_0_polynomial.coefficients[this->degree() - i] / temp_1_polynomial.coefficients[temp_1_polynomial.degree()];
-        temp_0_polynomial = *this + (temp_1_polynomial * Polynomial(this->field, new_coefficients));
-    }
-    return Polynomial(this->field, new_coefficients);
+    Polynomial new_polynomial;
+    Polynomial temp_0_polynomial;
+    this->divmod(polynomial, new_polynomial, temp_0_polynomial);
+    return new_polynomial;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,7 +181,7 @@ Polynomial Polynomial::operator-() const {
     for (int i = 0; i <= new_degree; i ++) {
         new_coefficients[i] = -this->coefficients[i];
     }
-    return Polynomial(this->field, new_coefficients);
+    return Polynomial(this->field, move(new_coefficients));
 }
 
 Polynomial Polynomial::operator-(const Polynomial& polynomial) const {
@@ -166,7 +192,10 @@ Polynomial Polynomial::operator-(const Polynomial& polynomial) const {
     } else if (polynomial.field != this->field) {
         throw "Maths\\Polynomial\\operator-(const Polynomial&)\\polynomial\\field";
     }
-    return (*this) + (-polynomial);
+    int new_degree = max(this->degree(), polynomial.degree());
+    Polynomial new_polynomial = this->redegree(new_degree);
+    new_polynomial -= polynomial;
+    return new_polynomial;
 }
 
 Polynomial Polynomial::operator%(const Polynomial& polynomial) const {
@@ -179,7 +208,101 @@ Polynomial Polynomial::operator%(const Polynomial& polynomial) const {
     }
     int new_degree = polynomial.degree() - 1;
     if (new_degree < 0) return Polynomial(this->field, {this->field->zero_element()});
-    return (*this - (polynomial * (*this / polynomial))).redegree(new_degree);
+    Polynomial temp_0_polynomial;
+    Polynomial new_polynomial;
+    this->divmod(polynomial, temp_0_polynomial, new_polynomial);
+    return new_polynomial;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Polynomial& Polynomial::operator+=(const Polynomial& polynomial) {
+    return this->multiply_add(polynomial, this->field->unit_element());
+}
+
+Polynomial& Polynomial::operator-=(const Polynomial& polynomial) {
+    return this->multiply_add(polynomial, -this->field->unit_element());
+}
+
+Polynomial& Polynomial::operator*=(const Element& scalar) {
+    if (*this == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\operator*=(const Element&)";
+    } else if (*scalar.field != *this->field) {
+        throw "Maths\\Polynomial\\operator*=(const Element&)\\scalar\\field";
+    }
+    if (this->field->compact) {
+        for (int i = 0; i < this->coefficients.size(); i ++) {
+            this->coefficients[i].bits = this->field->multiply(this->coefficients[i].bits, scalar.bits);
+        }
+    } else {
+        for (int i = 0; i < this->coefficients.size(); i ++) {
+            this->coefficients[i] = this->coefficients[i] * scalar;
+        }
+    }
+    return *this;
+}
+
+Polynomial& Polynomial::multiply_add(const Polynomial& polynomial, const Element& scalar, int shift) {
+    if (*this == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\multiply_add(const Polynomial&, const Element&, int)";
+    } else if (polynomial == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\multiply_add(const Polynomial&, const Element&, int)\\polynomial";
+    } else if (*polynomial.field != *this->field) {
+        throw "Maths\\Polynomial\\multiply_add(const Polynomial&, const Element&, int)\\polynomial\\field";
+    } else if (*scalar.field != *this->field) {
+        throw "Maths\\Polynomial\\multiply_add(const Polynomial&, const Element&, int)\\scalar\\field";
+    } else if (shift < 0) {
+        throw "Maths\\Polynomial\\multiply_add(const Polynomial&, const Element&, int)\\shift";
+    }
+    int temp_0_degree = polynomial.degree();
+    if (this->coefficients.size() < temp_0_degree + shift + 1) {
+        this->coefficients.resize(temp_0_degree + shift + 1, this->field->zero_element());
+    }
+    if (this->field->compact) {
+        if (scalar.bits == 0) return *this;
+        uint32_t temp_1_logarithm = this->field->logarithm_table[scalar.bits];
+        for (int i = 0; i <= temp_0_degree; i ++) {
+            uint32_t temp_2_bits = polynomial.coefficients[i].bits;
+            if (temp_2_bits == 0) continue;
+            this->coefficients[i + shift].bits = this->coefficients[i + shift].bits ^ this->field->exponent_table[temp_1_logarithm + this->field->logarithm_table[temp_2_bits]];
+        }
+    } else {
+        for (int i = 0; i <= temp_0_degree; i ++) {
+            this->coefficients[i + shift] = this->coefficients[i + shift] + polynomial.coefficients[i] * scalar;
+        }
+    }
+    return *this;
+}
+
+void Polynomial::divmod(const Polynomial& divisor, Polynomial& quotient, Polynomial& remainder) const {
+    if (*this == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\divmod(const Polynomial&, Polynomial&, Polynomial&)";
+    } else if (divisor == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\divmod(const Polynomial&, Polynomial&, Polynomial&)\\divisor";
+    } else if (*divisor.field != *this->field) {
+        throw "Maths\\Polynomial\\divmod(const Polynomial&, Polynomial&, Polynomial&)\\divisor\\field";
+    }
+    int temp_0_degree = divisor.degree();
+    Element temp_1_leading = divisor.coefficients[temp_0_degree];
+    if (temp_1_leading == this->field->zero_element()) {
+        throw "Maths\\Polynomial\\divmod(const Polynomial&, Polynomial&, Polynomial&)\\divisor";
+    }
+    int temp_2_degree = this->degree();
+    if (&remainder != this) {
+        remainder.field = this->field;
+        remainder.coefficients.assign(this->coefficients.begin(), this->coefficients.begin() + temp_2_degree + 1);
+    }
+    quotient.field = this->field;
+    quotient.coefficients.assign(max(temp_2_degree - temp_0_degree, 0) + 1, this->field->zero_element());
+    bool temp_3_monic = temp_1_leading == this->field->unit_element();
+    Element temp_4_inverse = temp_3_monic ? temp_1_leading : ~temp_1_leading;
+    for (int i = temp_2_degree; i >= temp_0_degree; i --) {
+        if (remainder.coefficients[i] == this->field->zero_element()) continue;
+        Element temp_5_factor = temp_3_monic ? remainder.coefficients[i] : remainder.coefficients[i] * temp_4_inverse;
+        quotient.coefficients[i - temp_0_degree] = temp_5_factor;
+        remainder.multiply_add(divisor, -temp_5_factor, i - temp_0_degree);
+    }
+    remainder.coefficients.resize(max(temp_0_degree, 1), this->field->zero_element());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,7 +318,7 @@ Polynomial Polynomial::operator*(const Element& scalar) const {
     for (int i = 0; i <= new_degree; i ++) {
         new_coefficients[i] = this->coefficients[i] * scalar;
     }
-    return Polynomial(this->field, new_coefficients);
+    return Polynomial(this->field, move(new_coefficients));
 }
 
 Element Polynomial::evaluate(const Element& argument) const {
@@ -204,24 +327,279 @@ Element Polynomial::evaluate(const Element& argument) const {
     } else if (argument.field != this->field) {
         throw "Maths\\Polynomial\\evaluate()\\argument\\field";
     }
-    Element new_element = this->field->zero_element();
-    for (int i = 0; i <= this->degree(); i ++) {
-        new_element = new_element + (this->coefficients[i] * (argument ^ i));
+    int temp_0_degree = this->degree();
+    Element new_element = this->coefficients[temp_0_degree];
+    for (int i = temp_0_degree - 1; i >= 0; i --) {
+        new_element = new_element * argument + this->coefficients[i];
     }
     return new_element;
 }
 
+void Polynomial::evaluate(const vector<Element>& arguments, vector<Element>& results) const {
+    if (*this == polynomials::default_polynomial) {
+        throw "Maths\\Polynomial\\evaluate(const vector<Element>&, vector<Element>&)";
+    } else if (results.size() < arguments.size()) {
+        throw "Maths\\Polynomial\\evaluate(const vector<Element>&, vector<Element>&)\\results\\size";
+    } else if (true) {
+        for (int i = 0; i < arguments.size(); i ++) {
+            if (arguments[i].field != this->field) {
+                throw "Maths\\Polynomial\\evaluate(const vector<Element>&, vector<Element>&)\\arguments\\field";
+            }
+        }
+    }
+    int temp_0_degree = this->degree();
+    for (int i = 0; i < arguments.size(); i ++) {
+        results[i] = this->coefficients[temp_0_degree];
+    }
+    if (this->field->compact) {
+        for (int i = temp_0_degree - 1; i >= 0; i --) {
+            uint32_t temp_1_bits = this->coefficients[i].bits;
+            for (int j = 0; j < arguments.size(); j ++) {
+                results[j].bits = this->field->add(this->field->multiply(results[j].bits, arguments[j].bits), temp_1_bits);
+            }
+        }
+    } else {
+        for (int i = temp_0_degree - 1; i >= 0; i --) {
+            for (int j = 0; j < arguments.size(); j ++) {
+                results[j] = results[j] * arguments[j] + this->coefficients[i];
+            }
+        }
+    }
+}
+
+void evaluate(const vector<Polynomial>& polynomials, const Element& argument, vector<Element>& results) {
+    if (results.size() < polynomials.size()) {
+        throw "Maths\\evaluate(const vector<Polynomial>&, const Element&, vector<Element>&)\\results\\size";
+    }
+    for (int i = 0; i < polynomials.size(); i ++) {
+        results[i] = polynomials[i].evaluate(argument);
+    }
+}
+
 Polynomial Polynomial::derivative() const {
     if (*this == polynomials::default_polynomial) {
         throw "Maths\\Polynomial\\derivative()";
     }
-    int new_degree = this->degree() - 1;
+    int new_degree = max(this->degree() - 1, 0);
     vector<Element> new_coefficients(new_degree + 1, this->field->zero_element());
-    for (int i = 0; i <= new_degree; i ++) {
+    for (int i = 0; i < this->degree(); i ++) {
         new_coefficients[i] = (this->coefficients[i + 1] * (i + 1));
     }
-    return Polynomial(this->field, new_coefficients);
+    return Polynomial(this->field, move(new_coefficients));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace polynomials {
+    static mutex transform_lock;
+    static map<pair<int, int>, pair<vector<vector<int>>, vector<vector<uint32_t>>>> transform_cache;
+
+    void schoolbook_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product) {
+        fill(product, product + left_size + right_size - 1, 0);
+        vector<int> temp_0_logarithms(right_size, -1);
+        for (int j = 0; j < right_size; j ++) {
+            if (right[j] != 0) temp_0_logarithms[j] = field->logarithm_table[right[j]];
+        }
+        for (int i = 0; i < left_size; i ++) {
+            if (left[i] == 0) continue;
+            const uint32_t* temp_1_exponents = &field->exponent_table[field->logarithm_table[left[i]]];
+            for (int j = 0; j < right_size; j ++) {
+                if (temp_0_logarithms[j] >= 0) {
+                    product[i + j] = product[i + j] ^ temp_1_exponents[temp_0_logarithms[j]];
+                }
+            }
+        }
+    }
+
+    void karatsuba_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product) {
+        if (left_size < right_size) {
+            swap(left, right);
+            swap(left_size, right_size);
+        }
+        if (right_size < max(karatsuba_threshold, 2)) {
+            schoolbook_multiply(field, left, left_size, right, right_size, product);
+            return;
+        }
+        fill(product, product + left_size + right_size - 1, 0);
+        if (2 * right_size <= left_size) {
+            vector<uint32_t> temp_0_product(2 * right_size - 1);
+            for (int i = 0; i < left_size; i += right_size) {
+                int temp_1_size = min(right_size, left_size - i);
+                karatsuba_multiply(field, left + i, temp_1_size, right, right_size, temp_0_product.data());
+                for (int j = 0; j < temp_1_size + right_size - 1; j ++) {
+                    product[i + j] = product[i + j] ^ temp_0_product[j];
+                }
+            }
+            return;
+        }
+        int temp_2_half = (left_size + 1) / 2;
+        vector<uint32_t> temp_3_low(2 * temp_2_half - 1);
+        vector<uint32_t> temp_4_middle(2 * temp_2_half - 1);
+        vector<uint32_t> temp_5_high(right_size > temp_2_half ? left_size + right_size - 2 * temp_2_half - 1 : 0);
+        vector<uint32_t> temp_6_left(left, left + temp_2_half);
+        vector<uint32_t> temp_7_right(right, right + temp_2_half);
+        for (int i = temp_2_half; i < left_size; i ++) {
+            temp_6_left[i - temp_2_half] = temp_6_left[i - temp_2_half] ^ left[i];
+        }
+        for (int i = temp_2_half; i < right_size; i ++) {
+            temp_7_right[i - temp_2_half] = temp_7_right[i - temp_2_half] ^ right[i];
+        }
+        karatsuba_multiply(field, left, temp_2_half, right, temp_2_half, temp_3_low.data());
+        karatsuba_multiply(field, temp_6_left.data(), temp_2_half, temp_7_right.data(), temp_2_half, temp_4_middle.data());
+        if (!temp_5_high.empty()) {
+            karatsuba_multiply(field, left + temp_2_half, left_size - temp_2_half, right + temp_2_half, right_size - temp_2_half, temp_5_high.data());
+        }
+        for (int i = 0; i < temp_3_low.size(); i ++) {
+            product[i] = product[i] ^ temp_3_low[i];
+            temp_4_middle[i] = temp_4_middle[i] ^ temp_3_low[i];
+        }
+        for (int i = 0; i < temp_5_high.size(); i ++) {
+            product[2 * temp_2_half + i] = product[2 * temp_2_half + i] ^ temp_5_high[i];
+            temp_4_middle[i] = temp_4_middle[i] ^ temp_5_high[i];
+        }
+        for (int i = 0; i < min<int>(temp_4_middle.size(), left_size + right_size - 1 - temp_2_half); i ++) {
+            product[temp_2_half + i] = product[temp_2_half + i] ^ temp_4_middle[i];
+        }
+    }
+
+    // Rewrites f(x) as the sum of (g0_i + x g1_i) (x^2 + x)^i in place, leaving g0_i at 2i and g1_i at 2i + 1
+    void taylor_expand(uint32_t* values, int size) {
+        if (size <= 2) return;
+        for (int i = size - 1; i >= size / 2; i --) {
+            values[i - size / 4] = values[i - size / 4] ^ values[i];
+        }
+        taylor_expand(values, size / 2);
+        taylor_expand(values + size / 2, size / 2);
+    }
+
+    void taylor_collapse(uint32_t* values, int size) {
+        if (size <= 2) return;
+        taylor_collapse(values, size / 2);
+        taylor_collapse(values + size / 2, size / 2);
+        for (int i = size / 2; i < size; i ++) {
+            values[i - size / 4] = values[i - size / 4] ^ values[i];
+        }
+    }
+
+    // Gao-Mateer additive FFT over a span of 2^level points, where points[level] and powers[level] hold the logarithms of the twiddles and basis powers
+    void additive_transform(Field* field, uint32_t* values, uint32_t* scratch, int level, const vector<vector<int>>& points, const vector<vector<uint32_t>>& powers, bool inverse) {
+        if (level == 0) return;
+        int temp_0_half = 1 << (level - 1);
+        int temp_1_order = field->size() - 1;
+        const uint32_t* temp_2_exponents = field->exponent_table.data();
+        const uint32_t* temp_3_logarithms = field->logarithm_table.data();
+        const int* temp_4_points = points[level].data();
+        const uint32_t* temp_5_powers = powers[level].data();
+        if (!inverse) {
+            for (int i = 1; i < 2 * temp_0_half; i ++) {
+                if (values[i] != 0) values[i] = temp_2_exponents[temp_3_logarithms[values[i]] + temp_5_powers[i]];
+            }
+            taylor_expand(values, 2 * temp_0_half);
+            for (int i = 0; i < temp_0_half; i ++) {
+                scratch[i] = values[2 * i];
+                scratch[temp_0_half + i] = values[2 * i + 1];
+            }
+            additive_transform(field, scratch, values, level - 1, points, powers, false);
+            additive_transform(field, scratch + temp_0_half, values + temp_0_half, level - 1, points, powers, false);
+            for (int j = 0; j < temp_0_half; j ++) {
+                uint32_t temp_6_odd = scratch[temp_0_half + j];
+                values[j] = scratch[j];
+                if (temp_6_odd != 0 && temp_4_points[j] >= 0) values[j] = values[j] ^ temp_2_exponents[temp_3_logarithms[temp_6_odd] + temp_4_points[j]];
+                values[temp_0_half + j] = values[j] ^ temp_6_odd;
+            }
+        } else {
+            for (int j = 0; j < temp_0_half; j ++) {
+                uint32_t temp_6_odd = values[j] ^ values[temp_0_half + j];
+                scratch[temp_0_half + j] = temp_6_odd;
+                scratch[j] = values[j];
+                if (temp_6_odd != 0 && temp_4_points[j] >= 0) scratch[j] = scratch[j] ^ temp_2_exponents[temp_3_logarithms[temp_6_odd] + temp_4_points[j]];
+            }
+            additive_transform(field, scratch, values, level - 1, points, powers, true);
+            additive_transform(field, scratch + temp_0_half, values + temp_0_half, level - 1, points, powers, true);
+            for (int i = 0; i < temp_0_half; i ++) {
+                values[2 * i] = scratch[i];
+                values[2 * i + 1] = scratch[temp_0_half + i];
+            }
+            taylor_collapse(values, 2 * temp_0_half);
+            for (int i = 1; i < 2 * temp_0_half; i ++) {
+                if (values[i] != 0) values[i] = temp_2_exponents[temp_3_logarithms[values[i]] + temp_1_order - temp_5_powers[i]];
+            }
+        }
+    }
+
+    // Twiddle and basis-power logarithms for a span of 2^level points, built once per field and level
+    const pair<vector<vector<int>>, vector<vector<uint32_t>>>& transform_tables(Field* field, int level) {
+        lock_guard<mutex> temp_0_guard(transform_lock);
+        auto temp_1_iterator = transform_cache.find({field->identity, level});
+        if (temp_1_iterator != transform_cache.end()) {
+            return temp_1_iterator->second;
+        }
+        int temp_2_order = field->size() - 1;
+        vector<uint32_t> temp_3_basis(level);
+        for (int i = 0; i < level; i ++) {
+            temp_3_basis[i] = field->exponent_table[i];
+        }
+        vector<vector<int>> new_points(level + 1);
+        vector<vector<uint32_t>> new_powers(level + 1);
+        for (int l = level; l > 0; l --) {
+            uint32_t temp_4_last = temp_3_basis[l - 1];
+            vector<uint32_t> temp_5_points(1 << (l - 1), 0);
+            for (int j = 1; j < temp_5_points.size(); j ++) {
+                temp_5_points[j] = temp_5_points[j & (j - 1)] ^ field->divide(temp_3_basis[__builtin_ctz(j)], temp_4_last);
+            }
+            new_points[l] = vector<int>(temp_5_points.size(), -1);
+            for (int j = 0; j < temp_5_points.size(); j ++) {
+                if (temp_5_points[j] != 0) new_points[l][j] = field->logarithm_table[temp_5_points[j]];
+            }
+            new_powers[l] = vector<uint32_t>(1 << l, 0);
+            for (int i = 1; i < new_powers[l].size(); i ++) {
+                new_powers[l][i] = (new_powers[l][i - 1] + field->logarithm_table[temp_4_last]) % temp_2_order;
+            }
+            for (int i = 0; i < l - 1; i ++) {
+                uint32_t temp_6_ratio = field->divide(temp_3_basis[i], temp_4_last);
+                temp_3_basis[i] = field->multiply(temp_6_ratio, temp_6_ratio) ^ temp_6_ratio;
+            }
+        }
+        return transform_cache.emplace(make_pair(field->identity, level), make_pair(move(new_points), move(new_powers))).first->second;
+    }
+
+    void transform_multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product) {
+        int temp_0_level = 0;
+        while ((1 << temp_0_level) < left_size + right_size - 1) temp_0_level ++;
+        if ((1 << temp_0_level) > field->size()) {
+            throw "Maths\\polynomials\\transform_multiply(Field*, const uint32_t*, int, const uint32_t*, int, uint32_t*)\\field";
+        }
+        const pair<vector<vector<int>>, vector<vector<uint32_t>>>& temp_1_tables = transform_tables(field, temp_0_level);
+        const vector<vector<int>>& temp_2_points = temp_1_tables.first;
+        const vector<vector<uint32_t>>& temp_3_powers = temp_1_tables.second;
+        int temp_4_size = 1 << temp_0_level;
+        vector<uint32_t> temp_5_left(temp_4_size, 0);
+        vector<uint32_t> temp_6_right(temp_4_size, 0);
+        vector<uint32_t> temp_7_scratch(temp_4_size);
+        copy_n(left, left_size, temp_5_left.begin());
+        copy_n(right, right_size, temp_6_right.begin());
+        additive_transform(field, temp_5_left.data(), temp_7_scratch.data(), temp_0_level, temp_2_points, temp_3_powers, false);
+        additive_transform(field, temp_6_right.data(), temp_7_scratch.data(), temp_0_level, temp_2_points, temp_3_powers, false);
+        for (int i = 0; i < temp_4_size; i ++) {
+            temp_5_left[i] = field->multiply(temp_5_left[i], temp_6_right[i]);
+        }
+        additive_transform(field, temp_5_left.data(), temp_7_scratch.data(), temp_0_level, temp_2_points, temp_3_powers, true);
+        copy_n(temp_5_left.begin(), left_size + right_size - 1, product);
+    }
+
+    void multiply(Field* field, const uint32_t* left, int left_size, const uint32_t* right, int right_size, uint32_t* product) {
+        if (left_size + right_size - 1 >= transform_threshold && left_size + right_size - 1 <= field->size()) {
+            transform_multiply(field, left, left_size, right, right_size, product);
+        } else if (min(left_size, right_size) >= karatsuba_threshold) {
+            karatsuba_multiply(field, left, left_size, right, right_size, product);
+        } else {
+            schoolbook_multiply(field, left, left_size, right, right_size, product);
+        }
+    }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// File: slice.cpp
+// Author: Nhat Khai Nguyen
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "maths.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Slice::Slice(const Matrix* matrix, int row, int column, int rows, int columns) {
+    if (row < 0 || rows < 0 || row + rows > matrix->row()) {
+        throw "Maths\\Slice\\Slice(const Matrix*, int, int, int, int)\\row";
+    } else if (column < 0 || columns < 0 || column + columns > matrix->column()) {
+        throw "Maths\\Slice\\Slice(const Matrix*, int, int, int, int)\\column";
+    }
+    this->matrix = matrix;
+    this->row_offset = row;
+    this->column_offset = column;
+    this->rows = rows;
+    this->columns = columns;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int Slice::row() const {
+    return this->rows;
+}
+
+int Slice::column() const {
+    return this->columns;
+}
+
+const Element& Slice::at(int row, int column) const {
+    return this->matrix->at(this->row_offset + row, this->column_offset + column);
+}
+
+Matrix Slice::copy() const {
+    Matrix new_matrix(this->matrix->field, this->row(), this->column());
+    for (int i = 0; i < this->row(); i ++) {
+        copy_n(&this->at(i, 0), this->column(), &new_matrix.at(i, 0));
+    }
+    return new_matrix;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Matrix Slice::operator*(const Slice& slice) const {
+    if (*slice.matrix->field != *this->matrix->field) {
+        throw "Maths\\Slice\\operator*(const Slice&)\\slice\\field";
+    } else if (slice.row() != this->column()) {
+        throw "Maths\\Slice\\operator*(const Slice&)\\slice\\row";
+    }
+    Field* temp_0_field = this->matrix->field;
+    Matrix new_matrix(temp_0_field, this->row(), slice.column());
+    if (!temp_0_field->compact) {
+        for (int i = 0; i < this->row(); i ++) {
+            for (int k = 0; k < this->column(); k ++) {
+                if (this->at(i, k) == temp_0_field->zero_element()) continue;
+                for (int j = 0; j < slice.column(); j ++) {
+                    new_matrix.at(i, j) = new_matrix.at(i, j) + this->at(i, k) * slice.at(k, j);
+                }
+            }
+        }
+        return new_matrix;
+    }
+    int temp_1_block = 64;
+    vector<int> temp_2_logarithms(slice.row() * slice.column(), -1);
+    for (int k = 0; k < slice.row(); k ++) {
+        for (int j = 0; j < slice.column(); j ++) {
+            uint32_t temp_3_bits = slice.at(k, j).bits;
+            if (temp_3_bits != 0) temp_2_logarithms[k * slice.column() + j] = temp_0_field->logarithm_table[temp_3_bits];
+        }
+    }
+    vector<uint32_t> temp_4_bits(this->row() * slice.column(), 0);
+    for (int l = 0; l < this->column(); l += temp_1_block) {
+        for (int m = 0; m < slice.column(); m += temp_1_block) {
+            for (int i = 0; i < this->row(); i ++) {
+                uint32_t* temp_5_row = &temp_4_bits[i * slice.column()];
+                for (int k = l; k < min(l + temp_1_block, this->column()); k ++) {
+                    uint32_t temp_6_bits = this->at(i, k).bits;
+                    if (temp_6_bits == 0) continue;
+                    uint32_t temp_7_logarithm = temp_0_field->logarithm_table[temp_6_bits];
+                    const int* temp_8_logarithms = &temp_2_logarithms[k * slice.column()];
+                    for (int j = m; j < min(m + temp_1_block, slice.column()); j ++) {
+                        if (temp_8_logarithms[j] >= 0) {
+                            temp_5_row[j] = temp_5_row[j] ^ temp_0_field->exponent_table[temp_7_logarithm + temp_8_logarithms[j]];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    for (int i = 0; i < temp_4_bits.size(); i ++) {
+        new_matrix.elements[i].bits = temp_4_bits[i];
+    }
+    return new_matrix;
+}
+
+Matrix Slice::operator*(const Matrix& matrix) const {
+    return (*this) * matrix.slice(0, 0, matrix.row(), matrix.column());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////
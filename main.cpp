@@ -47,46 +47,329 @@ int main() {
 // }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-// Confirmed that encoding can be performed as matrix multiplication
+// This main function can be used to compare generator-matrix encoding with LFSR encoding
 
 // #define BIN0 Element(false)
 // #define BIN1 Element(true)
-// int INT0 = 1;
+// int INT0 = 16;
 
-// Polynomial POL0(&fields::default_field, {BIN1, BIN1, BIN0, BIN1});
+// Polynomial POL0(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
 // Field FIE0(&POL0);
 // RS RS0(&FIE0, INT0);
 
-// #define ELE(i) FIE0.general_elements[i]
+// int main() {
+//     try {
+//         int INT1 = 100000;
+//         vector<uint8_t> vecMes(INT1 * RS0.message_length());
+//         vector<uint8_t> vecPar0(INT1 * RS0.parity_length());
+//         vector<uint8_t> vecPar1(INT1 * RS0.parity_length());
+//         for (int i = 0; i < vecMes.size(); i ++) {
+//             vecMes[i] = rand();
+//         }
+//         auto temp_0_start = chrono::steady_clock::now();
+//         for (int i = 0; i < INT1; i ++) {
+//             RS0.encode(&vecMes[i * RS0.message_length()], RS0.message_length(), &vecPar0[i * RS0.parity_length()], RS0.parity_length());
+//         }
+//         auto temp_1_middle = chrono::steady_clock::now();
+//         RS0.encode_batch(vecMes.data(), INT1, vecPar1.data());
+//         auto temp_2_stop = chrono::steady_clock::now();
+//         cout << "lfsr " << chrono::duration<double, milli>(temp_1_middle - temp_0_start).count() << " ms" << endl;
+//         cout << "matrix " << chrono::duration<double, milli>(temp_2_stop - temp_1_middle).count() << " ms" << endl;
+//         cout << boolalpha << (vecPar0 == vecPar1) << endl;
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to compare Euclidean decoding with BM decoding over GF(2^8)
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// vector<int> INTS0 = {8, 16, 32};
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
 
 // int main() {
 //     try {
-//         // ofstream output_file("Output/output.txt");
-//         cout << left << setw(16) << "polGen" << RS0.generator_polynomial << endl;
+//         int INT1 = 2000;
+//         for (int i = 0; i < INTS0.size(); i ++) {
+//             RS RS0(&FIE0, INTS0[i]);
+//             vector<Polynomial> vecRec;
+//             for (int j = 0; j < INT1; j ++) {
+//                 Polynomial polMes(&FIE0, vector<Element>(RS0.message_length(), FIE0.zero_element()));
+//                 Polynomial polErr(&FIE0, vector<Element>(RS0.codeword_length(), FIE0.zero_element()));
+//                 for (int k = 0; k < RS0.message_length(); k ++) {
+//                     polMes.coefficients[k] = FIE0.general_elements[rand() % FIE0.size()];
+//                 }
+//                 for (int k = 0; k < RS0.correction_capability(); k ++) {
+//                     polErr.coefficients[rand() % RS0.codeword_length()] = FIE0.general_elements[rand() % (FIE0.size() - 1)];
+//                 }
+//                 vecRec.push_back(RS0.add_error(RS0.systematic_encode(polMes), polErr));
+//             }
+//             auto temp_0_start = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 RS0.bm_decode(vecRec[j]);
+//             }
+//             auto temp_1_middle = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 RS0.euclidean_decode(vecRec[j]);
+//             }
+//             auto temp_2_stop = chrono::steady_clock::now();
+//             cout << left << setw(8) << "t" + to_string(INTS0[i]);
+//             cout << "bm " << setw(12) << chrono::duration<double, micro>(temp_1_middle - temp_0_start).count() / INT1;
+//             cout << "euclidean " << chrono::duration<double, micro>(temp_2_stop - temp_1_middle).count() / INT1 << " us" << endl;
+//         }
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to pick the polynomial multiplication thresholds over GF(2^16)
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// vector<int> INTS0 = {16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384};
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN1, BIN0, BIN1, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
+
+// int main() {
+//     try {
+//         for (int i = 0; i < INTS0.size(); i ++) {
+//             vector<uint32_t> vecLef(INTS0[i]);
+//             vector<uint32_t> vecRig(INTS0[i]);
+//             vector<uint32_t> vecPro(2 * INTS0[i] - 1);
+//             for (int j = 0; j < INTS0[i]; j ++) {
+//                 vecLef[j] = rand() % FIE0.size();
+//                 vecRig[j] = rand() % FIE0.size();
+//             }
+//             int INT1 = max(1, 1000000 / (INTS0[i] * INTS0[i]));
+//             auto temp_0_start = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 polynomials::schoolbook_multiply(&FIE0, vecLef.data(), INTS0[i], vecRig.data(), INTS0[i], vecPro.data());
+//             }
+//             auto temp_1_middle = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 polynomials::karatsuba_multiply(&FIE0, vecLef.data(), INTS0[i], vecRig.data(), INTS0[i], vecPro.data());
+//             }
+//             auto temp_2_middle = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 polynomials::transform_multiply(&FIE0, vecLef.data(), INTS0[i], vecRig.data(), INTS0[i], vecPro.data());
+//             }
+//             auto temp_3_stop = chrono::steady_clock::now();
+//             cout << left << setw(8) << "n" + to_string(INTS0[i]);
+//             cout << "schoolbook " << setw(12) << chrono::duration<double, micro>(temp_1_middle - temp_0_start).count() / INT1;
+//             cout << "karatsuba " << setw(12) << chrono::duration<double, micro>(temp_2_middle - temp_1_middle).count() / INT1;
+//             cout << "transform " << chrono::duration<double, micro>(temp_3_stop - temp_2_middle).count() / INT1 << " us" << endl;
+//         }
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to find where half-GCD decoding overtakes BM decoding over GF(2^12)
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// vector<int> INTS0 = {16, 32, 64, 128, 256, 512, 1024};
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN1, BIN0, BIN0, BIN1, BIN0, BIN1, BIN0, BIN0, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
+
+// int main() {
+//     try {
+//         int INT1 = 20;
+//         for (int i = 0; i < INTS0.size(); i ++) {
+//             RS RS0(&FIE0, INTS0[i]);
+//             vector<Polynomial> vecRec;
+//             for (int j = 0; j < INT1; j ++) {
+//                 Polynomial polMes(&FIE0, vector<Element>(RS0.message_length(), FIE0.zero_element()));
+//                 Polynomial polErr(&FIE0, vector<Element>(RS0.codeword_length(), FIE0.zero_element()));
+//                 for (int k = 0; k < RS0.correction_capability(); k ++) {
+//                     polErr.coefficients[rand() % RS0.codeword_length()] = FIE0.general_elements[rand() % (FIE0.size() - 1)];
+//                 }
+//                 vecRec.push_back(RS0.add_error(RS0.systematic_encode(polMes), polErr));
+//             }
+//             auto temp_0_start = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 RS0.bm_decode(vecRec[j]);
+//             }
+//             auto temp_1_middle = chrono::steady_clock::now();
+//             for (int j = 0; j < INT1; j ++) {
+//                 RS0.half_gcd_decode(vecRec[j]);
+//             }
+//             auto temp_2_stop = chrono::steady_clock::now();
+//             cout << left << setw(8) << "t" + to_string(INTS0[i]);
+//             cout << "bm " << setw(12) << chrono::duration<double, milli>(temp_1_middle - temp_0_start).count() / INT1;
+//             cout << "half_gcd " << chrono::duration<double, milli>(temp_2_stop - temp_1_middle).count() / INT1 << " ms" << endl;
+//         }
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to compare the runtime RS(255, 223) codec with the compiled one
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// int INT0 = 16;
 
-//         vector<vector<Element>> temp_0_elements(RS0.message_length(), vector<Element>(RS0.codeword_length(), FIE0.zero_element()));
+// Polynomial POL0(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
+// RS RS0(&FIE0, INT0);
+// compiled::RS<compiled::Field<8, 0x11D>, 16> RS1;
+
+// int main() {
+//     try {
+//         int INT1 = 100000;
+//         vector<uint8_t> vecCod0(INT1 * RS0.codeword_length());
+//         for (int i = 0; i < INT1; i ++) {
+//             uint8_t* temp_0_codeword = &vecCod0[i * RS0.codeword_length()];
+//             for (int j = RS0.parity_length(); j < RS0.codeword_length(); j ++) {
+//                 temp_0_codeword[j] = rand();
+//             }
+//             RS1.encode(temp_0_codeword + RS0.parity_length(), temp_0_codeword);
+//             for (int j = 0; j < INT0 / 2; j ++) {
+//                 temp_0_codeword[rand() % RS0.codeword_length()] ^= 1 + rand() % 255;
+//             }
+//         }
+//         vector<uint8_t> vecCod1 = vecCod0;
+//         auto temp_1_start = chrono::steady_clock::now();
+//         for (int i = 0; i < INT1; i ++) {
+//             RS0.decode(&vecCod0[i * RS0.codeword_length()], RS0.codeword_length());
+//         }
+//         auto temp_2_middle = chrono::steady_clock::now();
+//         for (int i = 0; i < INT1; i ++) {
+//             RS1.decode(&vecCod1[i * RS1.codeword_length()]);
+//         }
+//         auto temp_3_stop = chrono::steady_clock::now();
+//         cout << "runtime " << chrono::duration<double, micro>(temp_2_middle - temp_1_start).count() / INT1 << " us" << endl;
+//         cout << "compiled " << chrono::duration<double, micro>(temp_3_stop - temp_2_middle).count() / INT1 << " us" << endl;
+//         cout << boolalpha << (vecCod0 == vecCod1) << endl;
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to decode through interned fields shared by equal primitive polynomials
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// int INT0 = 16;
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Polynomial POL1(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field* FIE0 = fields::intern(&POL0);
+// Field* FIE1 = fields::intern(&POL1);
+// RS RS0(FIE0, INT0);
+
+// int main() {
+//     try {
+//         cout << (FIE0 == FIE1) << endl;
+//         vector<Element> vecMes0;
 //         for (int i = 0; i < RS0.message_length(); i ++) {
-//             Polynomial polMes(&FIE0, vector<Element>(RS0.message_length(), FIE0.zero_element()));
-//             polMes.coefficients[i] = FIE0.unit_element();
-//             Polynomial polCod = RS0.systematic_encode(polMes);
-//             temp_0_elements[i] = polCod.coefficients;
+//             vecMes0.push_back(FIE0->general_elements[rand() % FIE0->size()]);
 //         }
-//         Matrix temp_0_matrix = Matrix(&FIE0, temp_0_elements);
+//         Polynomial polMes0(FIE0, vecMes0);
+//         Polynomial polCod0 = RS0.systematic_encode(polMes0);
+//         vector<Element> vecErr0(RS0.codeword_length(), FIE0->zero_element());
+//         for (int i = 0; i < INT0; i ++) {
+//             vecErr0[i * 13] = FIE0->general_elements[i];
+//         }
+//         Polynomial polRec0 = RS0.add_error(polCod0, Polynomial(FIE1, vecErr0));
+//         int INT1 = 2000;
+//         auto temp_0_start = chrono::steady_clock::now();
+//         for (int i = 0; i < INT1; i ++) {
+//             if (RS0.bm_decode(polRec0) != polMes0) {
+//                 cout << "Failed" << endl;
+//             }
+//         }
+//         cout << chrono::duration<double, micro>(chrono::steady_clock::now() - temp_0_start).count() / INT1 << " us" << endl;
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
 
-//         Polynomial polMes(&FIE0, vector<Element>(RS0.message_length(), FIE0.zero_element()));
-//         polMes.coefficients[0] = ELE(0);
-//         polMes.coefficients[1] = ELE(0);
-//         polMes.coefficients[2] = ELE(1);
-//         cout << left << setw(16) << "polMes" << polMes << endl;
-//         vector<vector<Element>> temp_1_elements(1, vector<Element>(RS0.codeword_length(), FIE0.zero_element()));
-//         temp_1_elements[0] = polMes.coefficients;
-//         Matrix temp_1_matrix = Matrix(&FIE0, temp_1_elements);
-
-//         cout << left << setw(16) << "polCodSys" << RS0.systematic_encode(polMes) << endl;
-//         cout << left << setw(16) << "polCodMat" << Polynomial(&FIE0, (temp_1_matrix * temp_0_matrix).elements[0]) << endl;
-        
-//         // output_file.close();
-//         cout << "Harw" << endl;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to measure field construction time over GF(2^m)
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// vector<int> INTS0 = {0x7, 0xB, 0x13, 0x25, 0x43, 0x89, 0x11D, 0x211, 0x409, 0x805, 0x1053, 0x201B, 0x4443, 0x8003, 0x1100B};
+
+// int main() {
+//     try {
+//         for (int i = 0; i < INTS0.size(); i ++) {
+//             vector<Element> temp_0_coefficients;
+//             for (int j = INTS0[i]; j > 0; j = j >> 1) {
+//                 temp_0_coefficients.push_back((j & 1) ? BIN1 : BIN0);
+//             }
+//             Polynomial polPri(&fields::default_field, temp_0_coefficients);
+//             auto temp_1_start = chrono::steady_clock::now();
+//             Field fiePri(&polPri);
+//             auto temp_2_stop = chrono::steady_clock::now();
+//             cout << left << setw(8) << "m" + to_string(polPri.degree()) << setw(12) << "q" + to_string(fiePri.size()) << chrono::duration<double, milli>(temp_2_stop - temp_1_start).count() << " ms" << endl;
+//         }
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to protect a file with RS(255, 223) and repair it back
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// int INT0 = 16;
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN0, BIN1, BIN1, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
+// RS RS0(&FIE0, INT0);
+
+// int main() {
+//     try {
+//         Stream STR0(&RS0);
+//         STR0.encode("Input/input.bin", "Output/output.rs");
+//         cout << "encode" << " b" << STR0.blocks << " " << STR0.throughput() / 1e6 << " MB/s" << endl;
+//         STR0.decode("Output/output.rs", "Output/output.bin");
+//         cout << "decode" << " b" << STR0.blocks << " c" << STR0.corrected_symbols << " f" << STR0.failed_blocks << " " << STR0.throughput() / 1e6 << " MB/s" << endl;
+//     } catch (const char* error_message) {
+//         cout << error_message << endl;
+//     }
+//     return 0;
+// }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// This main function can be used to protect a file with RS(65535, 65503) over GF(2^16)
+
+// #define BIN0 Element(false)
+// #define BIN1 Element(true)
+// int INT0 = 16;
+
+// Polynomial POL0(&fields::default_field, {BIN1, BIN1, BIN0, BIN1, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN0, BIN1, BIN0, BIN0, BIN0, BIN1});
+// Field FIE0(&POL0);
+// RS RS0(&FIE0, INT0);
+
+// int main() {
+//     try {
+//         Stream STR0(&RS0);
+//         STR0.encode("Input/input.bin", "Output/output.rs");
+//         cout << "encode" << " b" << STR0.blocks << " " << STR0.throughput() / 1e6 << " MB/s" << endl;
+//         STR0.decode("Output/output.rs", "Output/output.bin");
+//         cout << "decode" << " b" << STR0.blocks << " c" << STR0.corrected_symbols << " f" << STR0.failed_blocks << " " << STR0.throughput() / 1e6 << " MB/s" << endl;
 //     } catch (const char* error_message) {
 //         cout << error_message << endl;
 //     }
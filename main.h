@@ -8,6 +8,7 @@
 #ifndef _MAIN_H_
 #define _MAIN_H_
 
+#include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>